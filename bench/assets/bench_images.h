@@ -0,0 +1,263 @@
+// Generated by tools/micro_ui_image.py, do not edit.
+#pragma once
+#include "micro_ui.h"
+
+// status_ok.png: 32x32, 489 bytes of flash (2048 raw)
+static const uint8_t status_ok_data[411] = {
+    0xAA, 0x00, 0x09, 0x02, 0x05, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x05, 0x02, 0x92, 0x00, 0x02,
+    0x01, 0x04, 0x08, 0x89, 0x0A, 0x02, 0x08, 0x04, 0x01, 0x8E, 0x00, 0x01, 0x03, 0x08, 0x8D, 0x0A,
+    0x01, 0x08, 0x03, 0x8C, 0x00, 0x00, 0x05, 0x91, 0x0A, 0x00, 0x05, 0x8A, 0x00, 0x00, 0x06, 0x93,
+    0x0A, 0x00, 0x06, 0x88, 0x00, 0x00, 0x05, 0x95, 0x0A, 0x00, 0x05, 0x86, 0x00, 0x00, 0x03, 0x97,
+    0x0A, 0x00, 0x03, 0x84, 0x00, 0x01, 0x01, 0x08, 0x97, 0x0A, 0x01, 0x08, 0x01, 0x83, 0x00, 0x00,
+    0x04, 0x92, 0x0A, 0x02, 0x16, 0x1E, 0x16, 0x83, 0x0A, 0x00, 0x04, 0x83, 0x00, 0x00, 0x08, 0x91,
+    0x0A, 0x00, 0x15, 0x82, 0x26, 0x00, 0x0E, 0x82, 0x0A, 0x00, 0x08, 0x82, 0x00, 0x00, 0x02, 0x91,
+    0x0A, 0x00, 0x13, 0x83, 0x26, 0x00, 0x0E, 0x83, 0x0A, 0x03, 0x02, 0x00, 0x00, 0x05, 0x90, 0x0A,
+    0x00, 0x11, 0x83, 0x26, 0x00, 0x18, 0x84, 0x0A, 0x03, 0x05, 0x00, 0x00, 0x07, 0x8F, 0x0A, 0x01,
+    0x0F, 0x24, 0x82, 0x26, 0x00, 0x19, 0x85, 0x0A, 0x03, 0x07, 0x00, 0x00, 0x08, 0x85, 0x0A, 0x01,
+    0x0E, 0x0E, 0x86, 0x0A, 0x01, 0x0D, 0x22, 0x82, 0x26, 0x00, 0x1B, 0x86, 0x0A, 0x03, 0x08, 0x00,
+    0x00, 0x09, 0x84, 0x0A, 0x03, 0x16, 0x26, 0x26, 0x17, 0x84, 0x0A, 0x01, 0x0B, 0x20, 0x82, 0x26,
+    0x00, 0x1D, 0x87, 0x0A, 0x03, 0x09, 0x00, 0x00, 0x09, 0x84, 0x0A, 0x00, 0x1E, 0x82, 0x26, 0x00,
+    0x17, 0x83, 0x0A, 0x00, 0x1E, 0x82, 0x26, 0x00, 0x1F, 0x88, 0x0A, 0x03, 0x09, 0x00, 0x00, 0x08,
+    0x84, 0x0A, 0x00, 0x16, 0x83, 0x26, 0x03, 0x17, 0x0A, 0x0A, 0x1C, 0x82, 0x26, 0x01, 0x21, 0x0C,
+    0x88, 0x0A, 0x03, 0x08, 0x00, 0x00, 0x07, 0x85, 0x0A, 0x00, 0x17, 0x83, 0x26, 0x01, 0x17, 0x1A,
+    0x82, 0x26, 0x01, 0x23, 0x0E, 0x89, 0x0A, 0x03, 0x07, 0x00, 0x00, 0x05, 0x86, 0x0A, 0x00, 0x17,
+    0x86, 0x26, 0x01, 0x25, 0x10, 0x8A, 0x0A, 0x03, 0x05, 0x00, 0x00, 0x02, 0x87, 0x0A, 0x00, 0x17,
+    0x85, 0x26, 0x00, 0x12, 0x8B, 0x0A, 0x00, 0x02, 0x82, 0x00, 0x00, 0x08, 0x87, 0x0A, 0x00, 0x17,
+    0x83, 0x26, 0x00, 0x14, 0x8B, 0x0A, 0x00, 0x08, 0x83, 0x00, 0x00, 0x04, 0x88, 0x0A, 0x03, 0x17,
+    0x26, 0x26, 0x16, 0x8C, 0x0A, 0x00, 0x04, 0x83, 0x00, 0x01, 0x01, 0x08, 0x88, 0x0A, 0x01, 0x0E,
+    0x0E, 0x8C, 0x0A, 0x01, 0x08, 0x01, 0x84, 0x00, 0x00, 0x03, 0x97, 0x0A, 0x00, 0x03, 0x86, 0x00,
+    0x00, 0x05, 0x95, 0x0A, 0x00, 0x05, 0x88, 0x00, 0x00, 0x06, 0x93, 0x0A, 0x00, 0x06, 0x8A, 0x00,
+    0x00, 0x05, 0x91, 0x0A, 0x00, 0x05, 0x8C, 0x00, 0x01, 0x03, 0x08, 0x8D, 0x0A, 0x01, 0x08, 0x03,
+    0x8E, 0x00, 0x02, 0x01, 0x04, 0x08, 0x89, 0x0A, 0x02, 0x08, 0x04, 0x01, 0x92, 0x00, 0x09, 0x02,
+    0x05, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x05, 0x02, 0xAA, 0x00
+};
+static const uint16_t status_ok_palette[39] = {
+    0x0000, 0x0040, 0x09C3, 0x1223, 0x1AE4, 0x1B65, 0x1BC6, 0x2487, 0x2D48, 0x2DA9,
+    0x2DC9, 0x35C9, 0x3DEA, 0x45EB, 0x4E0C, 0x562D, 0x5E2D, 0x664E, 0x664F, 0x6E70,
+    0x7691, 0x7E91, 0x86B2, 0x8EB3, 0x8ED3, 0x9EF5, 0xA6F5, 0xAF16, 0xB737, 0xBF38,
+    0xC759, 0xC779, 0xCF7A, 0xD79B, 0xDF9C, 0xE7BD, 0xEFDD, 0xF7DE, 0xFFFF
+};
+static const MicroImage status_ok = { 32, 32, IMAGE_RLE_INDEXED, 39, status_ok_palette, status_ok_data, sizeof(status_ok_data) };
+
+// sunset.png: 64x48, 3474 bytes of flash (6144 raw)
+static const uint8_t sunset_data[3474] = {
+    0x82, 0x9F, 0x02, 0x82, 0xBF, 0x02, 0x81, 0xDF, 0x02, 0x82, 0xFF, 0x02, 0x81, 0x1F, 0x03, 0x82,
+    0x3F, 0x03, 0x81, 0x5F, 0x03, 0x82, 0x7F, 0x03, 0x81, 0x9F, 0x03, 0x82, 0xBF, 0x03, 0x81, 0xDF,
+    0x03, 0x82, 0xFF, 0x03, 0x81, 0x1F, 0x04, 0x82, 0x3F, 0x04, 0x81, 0x5F, 0x04, 0x82, 0x7F, 0x04,
+    0x81, 0x9F, 0x04, 0x82, 0xBF, 0x04, 0x81, 0xDF, 0x04, 0x82, 0xFF, 0x04, 0x81, 0x1F, 0x05, 0x82,
+    0x3F, 0x05, 0x81, 0x5F, 0x05, 0x82, 0x7F, 0x05, 0x81, 0x9F, 0x05, 0x00, 0xBF, 0x05, 0x82, 0x9F,
+    0x02, 0x82, 0xBF, 0x02, 0x81, 0xDF, 0x02, 0x82, 0xFF, 0x02, 0x81, 0x1F, 0x03, 0x82, 0x3F, 0x03,
+    0x81, 0x5F, 0x03, 0x82, 0x7F, 0x03, 0x81, 0x9F, 0x03, 0x82, 0xBF, 0x03, 0x81, 0xDF, 0x03, 0x82,
+    0xFF, 0x03, 0x81, 0x1F, 0x04, 0x82, 0x3F, 0x04, 0x81, 0x5F, 0x04, 0x82, 0x7F, 0x04, 0x81, 0x9F,
+    0x04, 0x82, 0xBF, 0x04, 0x81, 0xDF, 0x04, 0x82, 0xFF, 0x04, 0x81, 0x1F, 0x05, 0x82, 0x3F, 0x05,
+    0x81, 0x5F, 0x05, 0x82, 0x7F, 0x05, 0x81, 0x9F, 0x05, 0x00, 0xBF, 0x05, 0x82, 0x9E, 0x0A, 0x82,
+    0xBE, 0x0A, 0x81, 0xDE, 0x0A, 0x82, 0xFE, 0x0A, 0x81, 0x1E, 0x0B, 0x82, 0x3E, 0x0B, 0x81, 0x5E,
+    0x0B, 0x82, 0x7E, 0x0B, 0x81, 0x9E, 0x0B, 0x82, 0xBE, 0x0B, 0x81, 0xDE, 0x0B, 0x82, 0xFE, 0x0B,
+    0x81, 0x1E, 0x0C, 0x82, 0x3E, 0x0C, 0x81, 0x5E, 0x0C, 0x82, 0x7E, 0x0C, 0x81, 0x9E, 0x0C, 0x82,
+    0xBE, 0x0C, 0x81, 0xDE, 0x0C, 0x82, 0xFE, 0x0C, 0x81, 0x1E, 0x0D, 0x82, 0x3E, 0x0D, 0x81, 0x5E,
+    0x0D, 0x82, 0x7E, 0x0D, 0x81, 0x9E, 0x0D, 0x00, 0xBE, 0x0D, 0x82, 0x9E, 0x12, 0x82, 0xBE, 0x12,
+    0x81, 0xDE, 0x12, 0x82, 0xFE, 0x12, 0x81, 0x1E, 0x13, 0x82, 0x3E, 0x13, 0x81, 0x5E, 0x13, 0x82,
+    0x7E, 0x13, 0x81, 0x9E, 0x13, 0x82, 0xBE, 0x13, 0x81, 0xDE, 0x13, 0x82, 0xFE, 0x13, 0x81, 0x1E,
+    0x14, 0x82, 0x3E, 0x14, 0x81, 0x5E, 0x14, 0x82, 0x7E, 0x14, 0x81, 0x9E, 0x14, 0x82, 0xBE, 0x14,
+    0x81, 0xDE, 0x14, 0x82, 0xFE, 0x14, 0x81, 0x1E, 0x15, 0x82, 0x3E, 0x15, 0x81, 0x5E, 0x15, 0x82,
+    0x7E, 0x15, 0x81, 0x9E, 0x15, 0x00, 0xBE, 0x15, 0x82, 0x9D, 0x12, 0x82, 0xBD, 0x12, 0x81, 0xDD,
+    0x12, 0x82, 0xFD, 0x12, 0x81, 0x1D, 0x13, 0x82, 0x3D, 0x13, 0x81, 0x5D, 0x13, 0x82, 0x7D, 0x13,
+    0x81, 0x9D, 0x13, 0x82, 0xBD, 0x13, 0x81, 0xDD, 0x13, 0x82, 0xFD, 0x13, 0x81, 0x1D, 0x14, 0x82,
+    0x3D, 0x14, 0x81, 0x5D, 0x14, 0x82, 0x7D, 0x14, 0x81, 0x9D, 0x14, 0x82, 0xBD, 0x14, 0x81, 0xDD,
+    0x14, 0x82, 0xFD, 0x14, 0x81, 0x1D, 0x15, 0x82, 0x3D, 0x15, 0x81, 0x5D, 0x15, 0x82, 0x7D, 0x15,
+    0x81, 0x9D, 0x15, 0x00, 0xBD, 0x15, 0x82, 0x9D, 0x1A, 0x82, 0xBD, 0x1A, 0x81, 0xDD, 0x1A, 0x82,
+    0xFD, 0x1A, 0x81, 0x1D, 0x1B, 0x82, 0x3D, 0x1B, 0x81, 0x5D, 0x1B, 0x82, 0x7D, 0x1B, 0x81, 0x9D,
+    0x1B, 0x82, 0xBD, 0x1B, 0x81, 0xDD, 0x1B, 0x82, 0xFD, 0x1B, 0x81, 0x1D, 0x1C, 0x82, 0x3D, 0x1C,
+    0x81, 0x5D, 0x1C, 0x82, 0x7D, 0x1C, 0x81, 0x9D, 0x1C, 0x82, 0xBD, 0x1C, 0x81, 0xDD, 0x1C, 0x82,
+    0xFD, 0x1C, 0x81, 0x1D, 0x1D, 0x82, 0x3D, 0x1D, 0x81, 0x5D, 0x1D, 0x82, 0x7D, 0x1D, 0x81, 0x9D,
+    0x1D, 0x00, 0xBD, 0x1D, 0x82, 0x9C, 0x22, 0x82, 0xBC, 0x22, 0x81, 0xDC, 0x22, 0x82, 0xFC, 0x22,
+    0x81, 0x1C, 0x23, 0x82, 0x3C, 0x23, 0x81, 0x5C, 0x23, 0x82, 0x7C, 0x23, 0x81, 0x9C, 0x23, 0x82,
+    0xBC, 0x23, 0x81, 0xDC, 0x23, 0x82, 0xFC, 0x23, 0x81, 0x1C, 0x24, 0x82, 0x3C, 0x24, 0x81, 0x5C,
+    0x24, 0x82, 0x7C, 0x24, 0x81, 0x9C, 0x24, 0x82, 0xBC, 0x24, 0x81, 0xDC, 0x24, 0x82, 0xFC, 0x24,
+    0x81, 0x1C, 0x25, 0x82, 0x3C, 0x25, 0x81, 0x5C, 0x25, 0x82, 0x7C, 0x25, 0x81, 0x9C, 0x25, 0x00,
+    0xBC, 0x25, 0x82, 0x9C, 0x22, 0x82, 0xBC, 0x22, 0x81, 0xDC, 0x22, 0x82, 0xFC, 0x22, 0x81, 0x1C,
+    0x23, 0x82, 0x3C, 0x23, 0x81, 0x5C, 0x23, 0x82, 0x7C, 0x23, 0x81, 0x9C, 0x23, 0x82, 0xBC, 0x23,
+    0x81, 0xDC, 0x23, 0x82, 0xFC, 0x23, 0x81, 0x1C, 0x24, 0x82, 0x3C, 0x24, 0x81, 0x5C, 0x24, 0x82,
+    0x7C, 0x24, 0x81, 0x9C, 0x24, 0x82, 0xBC, 0x24, 0x81, 0xDC, 0x24, 0x82, 0xFC, 0x24, 0x81, 0x1C,
+    0x25, 0x82, 0x3C, 0x25, 0x81, 0x5C, 0x25, 0x82, 0x7C, 0x25, 0x81, 0x9C, 0x25, 0x00, 0xBC, 0x25,
+    0x82, 0x9B, 0x2A, 0x82, 0xBB, 0x2A, 0x81, 0xDB, 0x2A, 0x82, 0xFB, 0x2A, 0x81, 0x1B, 0x2B, 0x82,
+    0x3B, 0x2B, 0x81, 0x5B, 0x2B, 0x82, 0x7B, 0x2B, 0x81, 0x9B, 0x2B, 0x82, 0xBB, 0x2B, 0x81, 0xDB,
+    0x2B, 0x82, 0xFB, 0x2B, 0x81, 0x1B, 0x2C, 0x82, 0x3B, 0x2C, 0x81, 0x5B, 0x2C, 0x82, 0x7B, 0x2C,
+    0x81, 0x9B, 0x2C, 0x82, 0xBB, 0x2C, 0x81, 0xDB, 0x2C, 0x82, 0xFB, 0x2C, 0x81, 0x1B, 0x2D, 0x82,
+    0x3B, 0x2D, 0x81, 0x5B, 0x2D, 0x82, 0x7B, 0x2D, 0x81, 0x9B, 0x2D, 0x00, 0xBB, 0x2D, 0x82, 0x9B,
+    0x32, 0x82, 0xBB, 0x32, 0x81, 0xDB, 0x32, 0x82, 0xFB, 0x32, 0x81, 0x1B, 0x33, 0x82, 0x3B, 0x33,
+    0x81, 0x5B, 0x33, 0x82, 0x7B, 0x33, 0x81, 0x9B, 0x33, 0x82, 0xBB, 0x33, 0x81, 0xDB, 0x33, 0x82,
+    0xFB, 0x33, 0x81, 0x1B, 0x34, 0x82, 0x3B, 0x34, 0x81, 0x5B, 0x34, 0x82, 0x7B, 0x34, 0x81, 0x9B,
+    0x34, 0x82, 0xBB, 0x34, 0x81, 0xDB, 0x34, 0x82, 0xFB, 0x34, 0x81, 0x1B, 0x35, 0x82, 0x3B, 0x35,
+    0x81, 0x5B, 0x35, 0x82, 0x7B, 0x35, 0x81, 0x9B, 0x35, 0x00, 0xBB, 0x35, 0x82, 0x9A, 0x32, 0x82,
+    0xBA, 0x32, 0x81, 0xDA, 0x32, 0x82, 0xFA, 0x32, 0x81, 0x1A, 0x33, 0x82, 0x3A, 0x33, 0x81, 0x5A,
+    0x33, 0x82, 0x7A, 0x33, 0x81, 0x9A, 0x33, 0x82, 0xBA, 0x33, 0x81, 0xDA, 0x33, 0x82, 0xFA, 0x33,
+    0x81, 0x1A, 0x34, 0x82, 0x3A, 0x34, 0x81, 0x5A, 0x34, 0x82, 0x7A, 0x34, 0x81, 0x9A, 0x34, 0x82,
+    0xBA, 0x34, 0x81, 0xDA, 0x34, 0x82, 0xFA, 0x34, 0x81, 0x1A, 0x35, 0x82, 0x3A, 0x35, 0x81, 0x5A,
+    0x35, 0x82, 0x7A, 0x35, 0x81, 0x9A, 0x35, 0x00, 0xBA, 0x35, 0x82, 0x9A, 0x3A, 0x82, 0xBA, 0x3A,
+    0x81, 0xDA, 0x3A, 0x82, 0xFA, 0x3A, 0x81, 0x1A, 0x3B, 0x82, 0x3A, 0x3B, 0x81, 0x5A, 0x3B, 0x82,
+    0x7A, 0x3B, 0x81, 0x9A, 0x3B, 0x82, 0xBA, 0x3B, 0x81, 0xDA, 0x3B, 0x82, 0xFA, 0x3B, 0x81, 0x1A,
+    0x3C, 0x82, 0x3A, 0x3C, 0x81, 0x5A, 0x3C, 0x82, 0x7A, 0x3C, 0x81, 0x9A, 0x3C, 0x82, 0xBA, 0x3C,
+    0x81, 0xDA, 0x3C, 0x82, 0xFA, 0x3C, 0x81, 0x1A, 0x3D, 0x82, 0x3A, 0x3D, 0x81, 0x5A, 0x3D, 0x82,
+    0x7A, 0x3D, 0x81, 0x9A, 0x3D, 0x00, 0xBA, 0x3D, 0x82, 0x99, 0x42, 0x82, 0xB9, 0x42, 0x81, 0xD9,
+    0x42, 0x82, 0xF9, 0x42, 0x81, 0x19, 0x43, 0x82, 0x39, 0x43, 0x81, 0x59, 0x43, 0x82, 0x79, 0x43,
+    0x81, 0x99, 0x43, 0x82, 0xB9, 0x43, 0x81, 0xD9, 0x43, 0x82, 0xF9, 0x43, 0x81, 0x19, 0x44, 0x82,
+    0x39, 0x44, 0x81, 0x59, 0x44, 0x82, 0x79, 0x44, 0x81, 0x99, 0x44, 0x82, 0xB9, 0x44, 0x81, 0xD9,
+    0x44, 0x82, 0xF9, 0x44, 0x81, 0x19, 0x45, 0x82, 0x39, 0x45, 0x81, 0x59, 0x45, 0x82, 0x79, 0x45,
+    0x81, 0x99, 0x45, 0x00, 0xB9, 0x45, 0x82, 0x98, 0x42, 0x82, 0xB8, 0x42, 0x81, 0xD8, 0x42, 0x82,
+    0xF8, 0x42, 0x81, 0x18, 0x43, 0x82, 0x38, 0x43, 0x81, 0x58, 0x43, 0x82, 0x78, 0x43, 0x81, 0x98,
+    0x43, 0x82, 0xB8, 0x43, 0x81, 0xD8, 0x43, 0x82, 0xF8, 0x43, 0x81, 0x18, 0x44, 0x82, 0x38, 0x44,
+    0x81, 0x58, 0x44, 0x82, 0x78, 0x44, 0x81, 0x98, 0x44, 0x82, 0xB8, 0x44, 0x81, 0xD8, 0x44, 0x82,
+    0xF8, 0x44, 0x81, 0x18, 0x45, 0x82, 0x38, 0x45, 0x81, 0x58, 0x45, 0x82, 0x78, 0x45, 0x81, 0x98,
+    0x45, 0x00, 0xB8, 0x45, 0x82, 0x98, 0x4A, 0x82, 0xB8, 0x4A, 0x81, 0xD8, 0x4A, 0x82, 0xF8, 0x4A,
+    0x81, 0x18, 0x4B, 0x82, 0x38, 0x4B, 0x81, 0x58, 0x4B, 0x82, 0x78, 0x4B, 0x81, 0x98, 0x4B, 0x82,
+    0xB8, 0x4B, 0x81, 0xD8, 0x4B, 0x82, 0xF8, 0x4B, 0x81, 0x18, 0x4C, 0x82, 0x38, 0x4C, 0x81, 0x58,
+    0x4C, 0x82, 0x78, 0x4C, 0x81, 0x98, 0x4C, 0x82, 0xB8, 0x4C, 0x81, 0xD8, 0x4C, 0x82, 0xF8, 0x4C,
+    0x81, 0x18, 0x4D, 0x82, 0x38, 0x4D, 0x81, 0x58, 0x4D, 0x82, 0x78, 0x4D, 0x81, 0x98, 0x4D, 0x00,
+    0xB8, 0x4D, 0x82, 0x97, 0x52, 0x82, 0xB7, 0x52, 0x81, 0xD7, 0x52, 0x82, 0xF7, 0x52, 0x81, 0x17,
+    0x53, 0x82, 0x37, 0x53, 0x81, 0x57, 0x53, 0x82, 0x77, 0x53, 0x81, 0x97, 0x53, 0x82, 0xB7, 0x53,
+    0x81, 0xD7, 0x53, 0x82, 0xF7, 0x53, 0x81, 0x17, 0x54, 0x82, 0x37, 0x54, 0x81, 0x57, 0x54, 0x82,
+    0x77, 0x54, 0x81, 0x97, 0x54, 0x82, 0xB7, 0x54, 0x81, 0xD7, 0x54, 0x82, 0xF7, 0x54, 0x81, 0x17,
+    0x55, 0x82, 0x37, 0x55, 0x81, 0x57, 0x55, 0x82, 0x77, 0x55, 0x81, 0x97, 0x55, 0x00, 0xB7, 0x55,
+    0x82, 0x97, 0x52, 0x82, 0xB7, 0x52, 0x81, 0xD7, 0x52, 0x82, 0xF7, 0x52, 0x81, 0x17, 0x53, 0x82,
+    0x37, 0x53, 0x81, 0x57, 0x53, 0x82, 0x77, 0x53, 0x81, 0x97, 0x53, 0x82, 0xB7, 0x53, 0x81, 0xD7,
+    0x53, 0x82, 0xF7, 0x53, 0x81, 0x17, 0x54, 0x82, 0x37, 0x54, 0x81, 0x57, 0x54, 0x82, 0x77, 0x54,
+    0x81, 0x97, 0x54, 0x82, 0xB7, 0x54, 0x81, 0xD7, 0x54, 0x82, 0xF7, 0x54, 0x81, 0x17, 0x55, 0x82,
+    0x37, 0x55, 0x81, 0x57, 0x55, 0x82, 0x77, 0x55, 0x81, 0x97, 0x55, 0x00, 0xB7, 0x55, 0x82, 0x96,
+    0x5A, 0x82, 0xB6, 0x5A, 0x81, 0xD6, 0x5A, 0x82, 0xF6, 0x5A, 0x81, 0x16, 0x5B, 0x82, 0x36, 0x5B,
+    0x81, 0x56, 0x5B, 0x82, 0x76, 0x5B, 0x81, 0x96, 0x5B, 0x82, 0xB6, 0x5B, 0x81, 0xD6, 0x5B, 0x82,
+    0xF6, 0x5B, 0x81, 0x16, 0x5C, 0x82, 0x36, 0x5C, 0x81, 0x56, 0x5C, 0x82, 0x76, 0x5C, 0x81, 0x96,
+    0x5C, 0x82, 0xB6, 0x5C, 0x81, 0xD6, 0x5C, 0x82, 0xF6, 0x5C, 0x81, 0x16, 0x5D, 0x82, 0x36, 0x5D,
+    0x81, 0x56, 0x5D, 0x82, 0x76, 0x5D, 0x81, 0x96, 0x5D, 0x00, 0xB6, 0x5D, 0x82, 0x96, 0x62, 0x82,
+    0xB6, 0x62, 0x81, 0xD6, 0x62, 0x82, 0xF6, 0x62, 0x81, 0x16, 0x63, 0x82, 0x36, 0x63, 0x81, 0x56,
+    0x63, 0x82, 0x76, 0x63, 0x81, 0x96, 0x63, 0x82, 0xB6, 0x63, 0x81, 0xD6, 0x63, 0x82, 0xF6, 0x63,
+    0x81, 0x16, 0x64, 0x82, 0x36, 0x64, 0x81, 0x56, 0x64, 0x82, 0x76, 0x64, 0x81, 0x96, 0x64, 0x82,
+    0xB6, 0x64, 0x81, 0xD6, 0x64, 0x82, 0xF6, 0x64, 0x81, 0x16, 0x65, 0x82, 0x36, 0x65, 0x81, 0x56,
+    0x65, 0x82, 0x76, 0x65, 0x81, 0x96, 0x65, 0x00, 0xB6, 0x65, 0x82, 0x95, 0x62, 0x82, 0xB5, 0x62,
+    0x81, 0xD5, 0x62, 0x82, 0xF5, 0x62, 0x81, 0x15, 0x63, 0x82, 0x35, 0x63, 0x81, 0x55, 0x63, 0x82,
+    0x75, 0x63, 0x81, 0x95, 0x63, 0x82, 0xB5, 0x63, 0x81, 0xD5, 0x63, 0x82, 0xF5, 0x63, 0x81, 0x15,
+    0x64, 0x82, 0x35, 0x64, 0x81, 0x55, 0x64, 0x82, 0x75, 0x64, 0x81, 0x95, 0x64, 0x82, 0xB5, 0x64,
+    0x81, 0xD5, 0x64, 0x82, 0xF5, 0x64, 0x81, 0x15, 0x65, 0x82, 0x35, 0x65, 0x81, 0x55, 0x65, 0x82,
+    0x75, 0x65, 0x81, 0x95, 0x65, 0x00, 0xB5, 0x65, 0x82, 0x95, 0x6A, 0x82, 0xB5, 0x6A, 0x81, 0xD5,
+    0x6A, 0x82, 0xF5, 0x6A, 0x81, 0x15, 0x6B, 0x82, 0x35, 0x6B, 0x81, 0x55, 0x6B, 0x82, 0x75, 0x6B,
+    0x81, 0x95, 0x6B, 0x82, 0xB5, 0x6B, 0x81, 0xD5, 0x6B, 0x82, 0xF5, 0x6B, 0x81, 0x15, 0x6C, 0x82,
+    0x35, 0x6C, 0x81, 0x55, 0x6C, 0x82, 0x75, 0x6C, 0x81, 0x95, 0x6C, 0x82, 0xB5, 0x6C, 0x81, 0xD5,
+    0x6C, 0x82, 0xF5, 0x6C, 0x81, 0x15, 0x6D, 0x82, 0x35, 0x6D, 0x81, 0x55, 0x6D, 0x82, 0x75, 0x6D,
+    0x81, 0x95, 0x6D, 0x00, 0xB5, 0x6D, 0x82, 0x94, 0x72, 0x82, 0xB4, 0x72, 0x81, 0xD4, 0x72, 0x82,
+    0xF4, 0x72, 0x81, 0x14, 0x73, 0x82, 0x34, 0x73, 0x81, 0x54, 0x73, 0x82, 0x74, 0x73, 0x81, 0x94,
+    0x73, 0x82, 0xB4, 0x73, 0x81, 0xD4, 0x73, 0x82, 0xF4, 0x73, 0x81, 0x14, 0x74, 0x82, 0x34, 0x74,
+    0x81, 0x54, 0x74, 0x81, 0x74, 0x74, 0x88, 0xE7, 0xFE, 0x81, 0xF4, 0x74, 0x81, 0x14, 0x75, 0x82,
+    0x34, 0x75, 0x81, 0x54, 0x75, 0x82, 0x74, 0x75, 0x81, 0x94, 0x75, 0x00, 0xB4, 0x75, 0x82, 0x94,
+    0x72, 0x82, 0xB4, 0x72, 0x81, 0xD4, 0x72, 0x82, 0xF4, 0x72, 0x81, 0x14, 0x73, 0x82, 0x34, 0x73,
+    0x81, 0x54, 0x73, 0x82, 0x74, 0x73, 0x81, 0x94, 0x73, 0x82, 0xB4, 0x73, 0x81, 0xD4, 0x73, 0x82,
+    0xF4, 0x73, 0x81, 0x14, 0x74, 0x82, 0x34, 0x74, 0x81, 0x54, 0x74, 0x00, 0x74, 0x74, 0x8A, 0xE7,
+    0xFE, 0x00, 0xF4, 0x74, 0x81, 0x14, 0x75, 0x82, 0x34, 0x75, 0x81, 0x54, 0x75, 0x82, 0x74, 0x75,
+    0x81, 0x94, 0x75, 0x00, 0xB4, 0x75, 0x82, 0x93, 0x7A, 0x82, 0xB3, 0x7A, 0x81, 0xD3, 0x7A, 0x82,
+    0xF3, 0x7A, 0x81, 0x13, 0x7B, 0x82, 0x33, 0x7B, 0x81, 0x53, 0x7B, 0x82, 0x73, 0x7B, 0x81, 0x93,
+    0x7B, 0x82, 0xB3, 0x7B, 0x81, 0xD3, 0x7B, 0x82, 0xF3, 0x7B, 0x81, 0x13, 0x7C, 0x82, 0x33, 0x7C,
+    0x00, 0x53, 0x7C, 0x8E, 0xE7, 0xFE, 0x00, 0x13, 0x7D, 0x82, 0x33, 0x7D, 0x81, 0x53, 0x7D, 0x82,
+    0x73, 0x7D, 0x81, 0x93, 0x7D, 0x00, 0xB3, 0x7D, 0x82, 0x93, 0x82, 0x82, 0xB3, 0x82, 0x81, 0xD3,
+    0x82, 0x82, 0xF3, 0x82, 0x81, 0x13, 0x83, 0x82, 0x33, 0x83, 0x81, 0x53, 0x83, 0x82, 0x73, 0x83,
+    0x81, 0x93, 0x83, 0x82, 0xB3, 0x83, 0x81, 0xD3, 0x83, 0x82, 0xF3, 0x83, 0x81, 0x13, 0x84, 0x82,
+    0x33, 0x84, 0x00, 0x53, 0x84, 0x8E, 0xE7, 0xFE, 0x00, 0x13, 0x85, 0x82, 0x33, 0x85, 0x81, 0x53,
+    0x85, 0x82, 0x73, 0x85, 0x81, 0x93, 0x85, 0x00, 0xB3, 0x85, 0x82, 0x92, 0x82, 0x82, 0xB2, 0x82,
+    0x81, 0xD2, 0x82, 0x82, 0xF2, 0x82, 0x81, 0x12, 0x83, 0x82, 0x32, 0x83, 0x81, 0x52, 0x83, 0x82,
+    0x72, 0x83, 0x81, 0x92, 0x83, 0x82, 0xB2, 0x83, 0x81, 0xD2, 0x83, 0x82, 0xF2, 0x83, 0x81, 0x12,
+    0x84, 0x82, 0x32, 0x84, 0x90, 0xE7, 0xFE, 0x82, 0x32, 0x85, 0x81, 0x52, 0x85, 0x82, 0x72, 0x85,
+    0x81, 0x92, 0x85, 0x00, 0xB2, 0x85, 0x82, 0x92, 0x8A, 0x82, 0xB2, 0x8A, 0x81, 0xD2, 0x8A, 0x82,
+    0xF2, 0x8A, 0x81, 0x12, 0x8B, 0x82, 0x32, 0x8B, 0x81, 0x52, 0x8B, 0x82, 0x72, 0x8B, 0x81, 0x92,
+    0x8B, 0x82, 0xB2, 0x8B, 0x81, 0xD2, 0x8B, 0x82, 0xF2, 0x8B, 0x81, 0x12, 0x8C, 0x81, 0x32, 0x8C,
+    0x92, 0xE7, 0xFE, 0x81, 0x32, 0x8D, 0x81, 0x52, 0x8D, 0x82, 0x72, 0x8D, 0x81, 0x92, 0x8D, 0x00,
+    0xB2, 0x8D, 0x82, 0x91, 0x92, 0x82, 0xB1, 0x92, 0x81, 0xD1, 0x92, 0x82, 0xF1, 0x92, 0x81, 0x11,
+    0x93, 0x82, 0x31, 0x93, 0x81, 0x51, 0x93, 0x82, 0x71, 0x93, 0x81, 0x91, 0x93, 0x82, 0xB1, 0x93,
+    0x81, 0xD1, 0x93, 0x82, 0xF1, 0x93, 0x81, 0x11, 0x94, 0x81, 0x31, 0x94, 0x92, 0xE7, 0xFE, 0x81,
+    0x31, 0x95, 0x81, 0x51, 0x95, 0x82, 0x71, 0x95, 0x81, 0x91, 0x95, 0x00, 0xB1, 0x95, 0x82, 0x90,
+    0x92, 0x82, 0xB0, 0x92, 0x81, 0xD0, 0x92, 0x82, 0xF0, 0x92, 0x81, 0x10, 0x93, 0x82, 0x30, 0x93,
+    0x81, 0x50, 0x93, 0x82, 0x70, 0x93, 0x81, 0x90, 0x93, 0x82, 0xB0, 0x93, 0x81, 0xD0, 0x93, 0x82,
+    0xF0, 0x93, 0x81, 0x10, 0x94, 0x81, 0x30, 0x94, 0x92, 0xE7, 0xFE, 0x81, 0x30, 0x95, 0x81, 0x50,
+    0x95, 0x82, 0x70, 0x95, 0x81, 0x90, 0x95, 0x00, 0xB0, 0x95, 0x82, 0x90, 0x9A, 0x82, 0xB0, 0x9A,
+    0x81, 0xD0, 0x9A, 0x82, 0xF0, 0x9A, 0x81, 0x10, 0x9B, 0x82, 0x30, 0x9B, 0x81, 0x50, 0x9B, 0x82,
+    0x70, 0x9B, 0x81, 0x90, 0x9B, 0x82, 0xB0, 0x9B, 0x81, 0xD0, 0x9B, 0x82, 0xF0, 0x9B, 0x81, 0x10,
+    0x9C, 0x81, 0x30, 0x9C, 0x92, 0xE7, 0xFE, 0x81, 0x30, 0x9D, 0x81, 0x50, 0x9D, 0x82, 0x70, 0x9D,
+    0x81, 0x90, 0x9D, 0x00, 0xB0, 0x9D, 0x82, 0x8F, 0xA2, 0x82, 0xAF, 0xA2, 0x81, 0xCF, 0xA2, 0x82,
+    0xEF, 0xA2, 0x81, 0x0F, 0xA3, 0x82, 0x2F, 0xA3, 0x81, 0x4F, 0xA3, 0x82, 0x6F, 0xA3, 0x81, 0x8F,
+    0xA3, 0x82, 0xAF, 0xA3, 0x81, 0xCF, 0xA3, 0x82, 0xEF, 0xA3, 0x81, 0x0F, 0xA4, 0x81, 0x2F, 0xA4,
+    0x92, 0xE7, 0xFE, 0x81, 0x2F, 0xA5, 0x81, 0x4F, 0xA5, 0x82, 0x6F, 0xA5, 0x81, 0x8F, 0xA5, 0x00,
+    0xAF, 0xA5, 0x82, 0x8F, 0xAA, 0x82, 0xAF, 0xAA, 0x81, 0xCF, 0xAA, 0x82, 0xEF, 0xAA, 0x81, 0x0F,
+    0xAB, 0x82, 0x2F, 0xAB, 0x81, 0x4F, 0xAB, 0x82, 0x6F, 0xAB, 0x81, 0x8F, 0xAB, 0x82, 0xAF, 0xAB,
+    0x81, 0xCF, 0xAB, 0x82, 0xEF, 0xAB, 0x81, 0x0F, 0xAC, 0x81, 0x2F, 0xAC, 0x92, 0xE7, 0xFE, 0x81,
+    0x2F, 0xAD, 0x81, 0x4F, 0xAD, 0x82, 0x6F, 0xAD, 0x81, 0x8F, 0xAD, 0x00, 0xAF, 0xAD, 0x82, 0x8E,
+    0xAA, 0x82, 0xAE, 0xAA, 0x81, 0xCE, 0xAA, 0x82, 0xEE, 0xAA, 0x81, 0x0E, 0xAB, 0x82, 0x2E, 0xAB,
+    0x81, 0x4E, 0xAB, 0x82, 0x6E, 0xAB, 0x81, 0x8E, 0xAB, 0x82, 0xAE, 0xAB, 0x81, 0xCE, 0xAB, 0x82,
+    0xEE, 0xAB, 0x81, 0x0E, 0xAC, 0x81, 0x2E, 0xAC, 0x92, 0xE7, 0xFE, 0x81, 0x2E, 0xAD, 0x81, 0x4E,
+    0xAD, 0x82, 0x6E, 0xAD, 0x81, 0x8E, 0xAD, 0x00, 0xAE, 0xAD, 0x82, 0x8E, 0xB2, 0x82, 0xAE, 0xB2,
+    0x81, 0xCE, 0xB2, 0x82, 0xEE, 0xB2, 0x81, 0x0E, 0xB3, 0x82, 0x2E, 0xB3, 0x81, 0x4E, 0xB3, 0x82,
+    0x6E, 0xB3, 0x81, 0x8E, 0xB3, 0x82, 0xAE, 0xB3, 0x81, 0xCE, 0xB3, 0x82, 0xEE, 0xB3, 0x81, 0x0E,
+    0xB4, 0x81, 0x2E, 0xB4, 0x92, 0xE7, 0xFE, 0x81, 0x2E, 0xB5, 0x81, 0x4E, 0xB5, 0x82, 0x6E, 0xB5,
+    0x81, 0x8E, 0xB5, 0x00, 0xAE, 0xB5, 0x82, 0x8D, 0xBA, 0x82, 0xAD, 0xBA, 0x81, 0xCD, 0xBA, 0x82,
+    0xED, 0xBA, 0x81, 0x0D, 0xBB, 0x82, 0x2D, 0xBB, 0x81, 0x4D, 0xBB, 0x82, 0x6D, 0xBB, 0x81, 0x8D,
+    0xBB, 0x82, 0xAD, 0xBB, 0x81, 0xCD, 0xBB, 0x82, 0xED, 0xBB, 0x81, 0x0D, 0xBC, 0x81, 0x2D, 0xBC,
+    0x92, 0xE7, 0xFE, 0x81, 0x2D, 0xBD, 0x81, 0x4D, 0xBD, 0x82, 0x6D, 0xBD, 0x81, 0x8D, 0xBD, 0x00,
+    0xAD, 0xBD, 0x82, 0x8D, 0xBA, 0x82, 0xAD, 0xBA, 0x81, 0xCD, 0xBA, 0x82, 0xED, 0xBA, 0x81, 0x0D,
+    0xBB, 0x82, 0x2D, 0xBB, 0x81, 0x4D, 0xBB, 0x82, 0x6D, 0xBB, 0x81, 0x8D, 0xBB, 0x82, 0xAD, 0xBB,
+    0x81, 0xCD, 0xBB, 0x82, 0xED, 0xBB, 0x81, 0x0D, 0xBC, 0x82, 0x2D, 0xBC, 0x90, 0xE7, 0xFE, 0x82,
+    0x2D, 0xBD, 0x81, 0x4D, 0xBD, 0x82, 0x6D, 0xBD, 0x81, 0x8D, 0xBD, 0x00, 0xAD, 0xBD, 0x82, 0x8C,
+    0xC2, 0x82, 0xAC, 0xC2, 0x81, 0xCC, 0xC2, 0x82, 0xEC, 0xC2, 0x81, 0x0C, 0xC3, 0x82, 0x2C, 0xC3,
+    0x81, 0x4C, 0xC3, 0x82, 0x6C, 0xC3, 0x81, 0x8C, 0xC3, 0x82, 0xAC, 0xC3, 0x81, 0xCC, 0xC3, 0x82,
+    0xEC, 0xC3, 0x81, 0x0C, 0xC4, 0x82, 0x2C, 0xC4, 0x00, 0x4C, 0xC4, 0x8E, 0xE7, 0xFE, 0x00, 0x0C,
+    0xC5, 0x82, 0x2C, 0xC5, 0x81, 0x4C, 0xC5, 0x82, 0x6C, 0xC5, 0x81, 0x8C, 0xC5, 0x00, 0xAC, 0xC5,
+    0x82, 0x8C, 0xCA, 0x82, 0xAC, 0xCA, 0x81, 0xCC, 0xCA, 0x82, 0xEC, 0xCA, 0x81, 0x0C, 0xCB, 0x82,
+    0x2C, 0xCB, 0x81, 0x4C, 0xCB, 0x82, 0x6C, 0xCB, 0x81, 0x8C, 0xCB, 0x82, 0xAC, 0xCB, 0x81, 0xCC,
+    0xCB, 0x82, 0xEC, 0xCB, 0x81, 0x0C, 0xCC, 0x82, 0x2C, 0xCC, 0x00, 0x4C, 0xCC, 0x8E, 0xE7, 0xFE,
+    0x00, 0x0C, 0xCD, 0x82, 0x2C, 0xCD, 0x81, 0x4C, 0xCD, 0x82, 0x6C, 0xCD, 0x81, 0x8C, 0xCD, 0x00,
+    0xAC, 0xCD, 0x82, 0x8B, 0xCA, 0x82, 0xAB, 0xCA, 0x81, 0xCB, 0xCA, 0x82, 0xEB, 0xCA, 0x81, 0x0B,
+    0xCB, 0x82, 0x2B, 0xCB, 0x81, 0x4B, 0xCB, 0x82, 0x6B, 0xCB, 0x81, 0x8B, 0xCB, 0x82, 0xAB, 0xCB,
+    0x81, 0xCB, 0xCB, 0x82, 0xEB, 0xCB, 0x81, 0x0B, 0xCC, 0x82, 0x2B, 0xCC, 0x81, 0x4B, 0xCC, 0x00,
+    0x6B, 0xCC, 0x8A, 0xE7, 0xFE, 0x00, 0xEB, 0xCC, 0x81, 0x0B, 0xCD, 0x82, 0x2B, 0xCD, 0x81, 0x4B,
+    0xCD, 0x82, 0x6B, 0xCD, 0x81, 0x8B, 0xCD, 0x00, 0xAB, 0xCD, 0x82, 0x8B, 0xD2, 0x82, 0xAB, 0xD2,
+    0x81, 0xCB, 0xD2, 0x82, 0xEB, 0xD2, 0x81, 0x0B, 0xD3, 0x82, 0x2B, 0xD3, 0x81, 0x4B, 0xD3, 0x82,
+    0x6B, 0xD3, 0x81, 0x8B, 0xD3, 0x82, 0xAB, 0xD3, 0x81, 0xCB, 0xD3, 0x82, 0xEB, 0xD3, 0x81, 0x0B,
+    0xD4, 0x82, 0x2B, 0xD4, 0x81, 0x4B, 0xD4, 0x81, 0x6B, 0xD4, 0x88, 0xE7, 0xFE, 0x81, 0xEB, 0xD4,
+    0x81, 0x0B, 0xD5, 0x82, 0x2B, 0xD5, 0x81, 0x4B, 0xD5, 0x82, 0x6B, 0xD5, 0x81, 0x8B, 0xD5, 0x00,
+    0xAB, 0xD5, 0x82, 0x8A, 0xDA, 0x82, 0xAA, 0xDA, 0x81, 0xCA, 0xDA, 0x82, 0xEA, 0xDA, 0x81, 0x0A,
+    0xDB, 0x82, 0x2A, 0xDB, 0x81, 0x4A, 0xDB, 0x82, 0x6A, 0xDB, 0x81, 0x8A, 0xDB, 0x82, 0xAA, 0xDB,
+    0x81, 0xCA, 0xDB, 0x82, 0xEA, 0xDB, 0x81, 0x0A, 0xDC, 0x82, 0x2A, 0xDC, 0x81, 0x4A, 0xDC, 0x82,
+    0x6A, 0xDC, 0x81, 0x8A, 0xDC, 0x82, 0xAA, 0xDC, 0x81, 0xCA, 0xDC, 0x82, 0xEA, 0xDC, 0x81, 0x0A,
+    0xDD, 0x82, 0x2A, 0xDD, 0x81, 0x4A, 0xDD, 0x82, 0x6A, 0xDD, 0x81, 0x8A, 0xDD, 0x00, 0xAA, 0xDD,
+    0x82, 0x8A, 0xDA, 0x82, 0xAA, 0xDA, 0x81, 0xCA, 0xDA, 0x82, 0xEA, 0xDA, 0x81, 0x0A, 0xDB, 0x82,
+    0x2A, 0xDB, 0x81, 0x4A, 0xDB, 0x82, 0x6A, 0xDB, 0x81, 0x8A, 0xDB, 0x82, 0xAA, 0xDB, 0x81, 0xCA,
+    0xDB, 0x82, 0xEA, 0xDB, 0x81, 0x0A, 0xDC, 0x82, 0x2A, 0xDC, 0x81, 0x4A, 0xDC, 0x82, 0x6A, 0xDC,
+    0x81, 0x8A, 0xDC, 0x82, 0xAA, 0xDC, 0x81, 0xCA, 0xDC, 0x82, 0xEA, 0xDC, 0x81, 0x0A, 0xDD, 0x82,
+    0x2A, 0xDD, 0x81, 0x4A, 0xDD, 0x82, 0x6A, 0xDD, 0x81, 0x8A, 0xDD, 0x00, 0xAA, 0xDD, 0x82, 0x89,
+    0xE2, 0x82, 0xA9, 0xE2, 0x81, 0xC9, 0xE2, 0x82, 0xE9, 0xE2, 0x81, 0x09, 0xE3, 0x82, 0x29, 0xE3,
+    0x81, 0x49, 0xE3, 0x82, 0x69, 0xE3, 0x81, 0x89, 0xE3, 0x82, 0xA9, 0xE3, 0x81, 0xC9, 0xE3, 0x82,
+    0xE9, 0xE3, 0x81, 0x09, 0xE4, 0x82, 0x29, 0xE4, 0x81, 0x49, 0xE4, 0x82, 0x69, 0xE4, 0x81, 0x89,
+    0xE4, 0x82, 0xA9, 0xE4, 0x81, 0xC9, 0xE4, 0x82, 0xE9, 0xE4, 0x81, 0x09, 0xE5, 0x82, 0x29, 0xE5,
+    0x81, 0x49, 0xE5, 0x82, 0x69, 0xE5, 0x81, 0x89, 0xE5, 0x00, 0xA9, 0xE5, 0x82, 0x89, 0xEA, 0x82,
+    0xA9, 0xEA, 0x81, 0xC9, 0xEA, 0x82, 0xE9, 0xEA, 0x81, 0x09, 0xEB, 0x82, 0x29, 0xEB, 0x81, 0x49,
+    0xEB, 0x82, 0x69, 0xEB, 0x81, 0x89, 0xEB, 0x82, 0xA9, 0xEB, 0x81, 0xC9, 0xEB, 0x82, 0xE9, 0xEB,
+    0x81, 0x09, 0xEC, 0x82, 0x29, 0xEC, 0x81, 0x49, 0xEC, 0x82, 0x69, 0xEC, 0x81, 0x89, 0xEC, 0x82,
+    0xA9, 0xEC, 0x81, 0xC9, 0xEC, 0x82, 0xE9, 0xEC, 0x81, 0x09, 0xED, 0x82, 0x29, 0xED, 0x81, 0x49,
+    0xED, 0x82, 0x69, 0xED, 0x81, 0x89, 0xED, 0x00, 0xA9, 0xED, 0x82, 0x88, 0xEA, 0x82, 0xA8, 0xEA,
+    0x81, 0xC8, 0xEA, 0x82, 0xE8, 0xEA, 0x81, 0x08, 0xEB, 0x82, 0x28, 0xEB, 0x81, 0x48, 0xEB, 0x82,
+    0x68, 0xEB, 0x81, 0x88, 0xEB, 0x82, 0xA8, 0xEB, 0x81, 0xC8, 0xEB, 0x82, 0xE8, 0xEB, 0x81, 0x08,
+    0xEC, 0x82, 0x28, 0xEC, 0x81, 0x48, 0xEC, 0x82, 0x68, 0xEC, 0x81, 0x88, 0xEC, 0x82, 0xA8, 0xEC,
+    0x81, 0xC8, 0xEC, 0x82, 0xE8, 0xEC, 0x81, 0x08, 0xED, 0x82, 0x28, 0xED, 0x81, 0x48, 0xED, 0x82,
+    0x68, 0xED, 0x81, 0x88, 0xED, 0x00, 0xA8, 0xED, 0x82, 0x87, 0xF2, 0x82, 0xA7, 0xF2, 0x81, 0xC7,
+    0xF2, 0x82, 0xE7, 0xF2, 0x81, 0x07, 0xF3, 0x82, 0x27, 0xF3, 0x81, 0x47, 0xF3, 0x82, 0x67, 0xF3,
+    0x81, 0x87, 0xF3, 0x82, 0xA7, 0xF3, 0x81, 0xC7, 0xF3, 0x82, 0xE7, 0xF3, 0x81, 0x07, 0xF4, 0x82,
+    0x27, 0xF4, 0x81, 0x47, 0xF4, 0x82, 0x67, 0xF4, 0x81, 0x87, 0xF4, 0x82, 0xA7, 0xF4, 0x81, 0xC7,
+    0xF4, 0x82, 0xE7, 0xF4, 0x81, 0x07, 0xF5, 0x82, 0x27, 0xF5, 0x81, 0x47, 0xF5, 0x82, 0x67, 0xF5,
+    0x81, 0x87, 0xF5, 0x00, 0xA7, 0xF5, 0x82, 0x87, 0xFA, 0x82, 0xA7, 0xFA, 0x81, 0xC7, 0xFA, 0x82,
+    0xE7, 0xFA, 0x81, 0x07, 0xFB, 0x82, 0x27, 0xFB, 0x81, 0x47, 0xFB, 0x82, 0x67, 0xFB, 0x81, 0x87,
+    0xFB, 0x82, 0xA7, 0xFB, 0x81, 0xC7, 0xFB, 0x82, 0xE7, 0xFB, 0x81, 0x07, 0xFC, 0x82, 0x27, 0xFC,
+    0x81, 0x47, 0xFC, 0x82, 0x67, 0xFC, 0x81, 0x87, 0xFC, 0x82, 0xA7, 0xFC, 0x81, 0xC7, 0xFC, 0x82,
+    0xE7, 0xFC, 0x81, 0x07, 0xFD, 0x82, 0x27, 0xFD, 0x81, 0x47, 0xFD, 0x82, 0x67, 0xFD, 0x81, 0x87,
+    0xFD, 0x00, 0xA7, 0xFD, 0x82, 0x86, 0xFA, 0x82, 0xA6, 0xFA, 0x81, 0xC6, 0xFA, 0x82, 0xE6, 0xFA,
+    0x81, 0x06, 0xFB, 0x82, 0x26, 0xFB, 0x81, 0x46, 0xFB, 0x82, 0x66, 0xFB, 0x81, 0x86, 0xFB, 0x82,
+    0xA6, 0xFB, 0x81, 0xC6, 0xFB, 0x82, 0xE6, 0xFB, 0x81, 0x06, 0xFC, 0x82, 0x26, 0xFC, 0x81, 0x46,
+    0xFC, 0x82, 0x66, 0xFC, 0x81, 0x86, 0xFC, 0x82, 0xA6, 0xFC, 0x81, 0xC6, 0xFC, 0x82, 0xE6, 0xFC,
+    0x81, 0x06, 0xFD, 0x82, 0x26, 0xFD, 0x81, 0x46, 0xFD, 0x82, 0x66, 0xFD, 0x81, 0x86, 0xFD, 0x00,
+    0xA6, 0xFD
+};
+static const MicroImage sunset = { 64, 48, IMAGE_RLE565, 0, nullptr, sunset_data, sizeof(sunset_data) };
@@ -0,0 +1,40 @@
+// Generated by tools/micro_ui_font.py, do not edit.
+// bench_digits.ttf, 17 glyphs, 3 kerning pairs, 1 bpp: 366 bytes of flash
+#pragma once
+#include "micro_ui.h"
+
+static const uint8_t font_digits14_bitmaps[124] = {
+    0xF0, 0x80, 0x38, 0xFB, 0x14, 0x28, 0x70, 0xE1, 0x42, 0x4C, 0xF0, 0x7C, 0x92, 0x49, 0x24, 0xFC,
+    0x0C, 0x08, 0x10, 0x7F, 0xA0, 0x40, 0x81, 0xFC, 0xFC, 0x0C, 0x08, 0x10, 0x6F, 0x80, 0x81, 0x03,
+    0xFC, 0x83, 0x06, 0x0C, 0x37, 0xC0, 0x40, 0x81, 0xFD, 0x02, 0x04, 0x08, 0x0F, 0x80, 0x81, 0x03,
+    0xFC, 0xFD, 0x02, 0x04, 0x08, 0x1F, 0xA0, 0xC1, 0x83, 0xFC, 0xFC, 0x0C, 0x08, 0x10, 0x20, 0x00,
+    0x81, 0x02, 0xFD, 0x0E, 0x0C, 0x18, 0x7F, 0xA0, 0xC1, 0x83, 0xFC, 0xFD, 0x0E, 0x0C, 0x18, 0x6F,
+    0x80, 0x81, 0x03, 0xFC, 0x08, 0x0E, 0x07, 0x02, 0x83, 0x61, 0x11, 0xFC, 0xFE, 0x41, 0x60, 0xC0,
+    0x80, 0xA0, 0x90, 0x4C, 0x62, 0x21, 0x30, 0x50, 0x38, 0x1C, 0x04, 0x00, 0x7B, 0x38, 0xE3, 0xFC,
+    0xD0, 0x41, 0x07, 0xE0, 0x82, 0x08, 0x22, 0x93, 0x8F, 0x26, 0x8A, 0x10
+};
+static const MicroFontGlyph font_digits14_glyphs[17] = {
+    { 0x0020,   0,   0,    0,    0,   4,      0 },  //  
+    { 0x002D,   4,   1,    1,    7,   6,      0 },  // -
+    { 0x002E,   1,   1,    1,   11,   3,      1 },  // .
+    { 0x0030,   7,  10,    1,    2,   8,      2 },  // 0
+    { 0x0031,   3,  10,    2,    2,   8,     11 },  // 1
+    { 0x0032,   7,  10,    1,    2,   8,     15 },  // 2
+    { 0x0033,   7,  10,    1,    2,   8,     24 },  // 3
+    { 0x0034,   7,   8,    1,    3,   8,     33 },  // 4
+    { 0x0035,   7,  10,    1,    2,   8,     40 },  // 5
+    { 0x0036,   7,  10,    1,    2,   8,     49 },  // 6
+    { 0x0037,   7,   9,    1,    2,   8,     58 },  // 7
+    { 0x0038,   7,  10,    1,    2,   8,     66 },  // 8
+    { 0x0039,   7,  10,    1,    2,   8,     75 },  // 9
+    { 0x0041,   9,  10,    0,    2,   9,     84 },  // A
+    { 0x0056,   9,  10,    0,    2,   9,     96 },  // V
+    { 0x0067,   6,  10,    1,    5,   8,    108 },  // g
+    { 0x006B,   6,  10,    1,    2,   8,    116 },  // k
+};
+static const MicroFontKern font_digits14_kerns[3] = {
+    { 0x0031, 0x0031, -1 },
+    { 0x0041, 0x0056, -1 },
+    { 0x0056, 0x0041, -1 }
+};
+static const MicroFont font_digits14 = { font_digits14_glyphs, font_digits14_bitmaps, font_digits14_kerns, 17, 3, 1, 15, 12 };
@@ -0,0 +1,64 @@
+// Generated by tools/micro_ui_font.py, do not edit.
+// bench_digits.ttf, 17 glyphs, 3 kerning pairs, 2 bpp: 742 bytes of flash
+#pragma once
+#include "micro_ui.h"
+
+static const uint8_t font_digits20_bitmaps[500] = {
+    0xAA, 0xAB, 0xFE, 0xB6, 0xD0, 0x06, 0xF9, 0x01, 0xFF, 0xF4, 0x3D, 0x07, 0xC7, 0x80, 0x2D, 0xB4,
+    0x01, 0xEB, 0x00, 0x0E, 0xB0, 0x00, 0xEB, 0x00, 0x0E, 0xB0, 0x00, 0xEB, 0x40, 0x1E, 0x78, 0x02,
+    0xD3, 0xD0, 0x7C, 0x1F, 0xFF, 0x40, 0x6F, 0x90, 0x07, 0x8B, 0xE7, 0x68, 0x0A, 0x02, 0x80, 0xA0,
+    0x28, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x80, 0xA0, 0xBF, 0xFF, 0xE5, 0x55, 0x5A, 0x00,
+    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x6A, 0xAA, 0xEB, 0xAA, 0xA9, 0xA0, 0x00,
+    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA5, 0x55, 0x5B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE5,
+    0x55, 0x5A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x6A, 0xAA, 0xE6, 0xAA,
+    0xAE, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x55, 0x55, 0xAB, 0xFF, 0xFE,
+    0x90, 0x00, 0x6A, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xBA,
+    0xAA, 0xE6, 0xAA, 0xAE, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
+    0xA0, 0x00, 0x06, 0xBF, 0xFF, 0xEA, 0x55, 0x55, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
+    0x00, 0x00, 0xBA, 0xAA, 0x96, 0xAA, 0xAE, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
+    0x0A, 0x55, 0x55, 0xAB, 0xFF, 0xFE, 0xBF, 0xFF, 0xEA, 0x55, 0x55, 0xA0, 0x00, 0x0A, 0x00, 0x00,
+    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xBA, 0xAA, 0x9B, 0xAA, 0xAE, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xA0,
+    0x00, 0xAA, 0x00, 0x0A, 0xA5, 0x55, 0xAB, 0xFF, 0xFE, 0xBF, 0xFF, 0xE5, 0x55, 0x5A, 0x00, 0x00,
+    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
+    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x06, 0xBF, 0xFF, 0xEA, 0x55,
+    0x5A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xBA, 0xAA, 0xEB, 0xAA, 0xAE,
+    0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xA5, 0x55, 0xAB, 0xFF, 0xFE, 0xBF,
+    0xFF, 0xEA, 0x55, 0x5A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xBA, 0xAA,
+    0xE6, 0xAA, 0xAE, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x55, 0x55, 0xAB,
+    0xFF, 0xFE, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xDE, 0x00, 0x01,
+    0xE3, 0xC0, 0x00, 0xB4, 0xB4, 0x00, 0x3C, 0x0E, 0x00, 0x1E, 0x02, 0xD0, 0x0B, 0x00, 0x78, 0x07,
+    0xFF, 0xFF, 0x02, 0xE5, 0x56, 0xD0, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x0B, 0x6D, 0x00, 0x01, 0xE0,
+    0xB4, 0x00, 0x07, 0x9E, 0x00, 0x02, 0xD3, 0xC0, 0x01, 0xE0, 0xB4, 0x00, 0xB4, 0x1E, 0x00, 0x3C,
+    0x02, 0xC0, 0x1E, 0x00, 0x78, 0x0B, 0x40, 0x0F, 0x03, 0x80, 0x02, 0xD2, 0xD0, 0x00, 0x78, 0xF0,
+    0x00, 0x0B, 0x78, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x1B, 0xF9,
+    0x1F, 0xAB, 0xEB, 0x40, 0xBA, 0xC0, 0x0E, 0xB0, 0x03, 0xAD, 0x02, 0xE7, 0xEA, 0xF8, 0x6F, 0xEA,
+    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x55, 0x55, 0x6F, 0xFF, 0x90, 0xA0, 0x00,
+    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x01, 0x4A, 0x00, 0xB4, 0xA0, 0x2D, 0x0A,
+    0x1F, 0x40, 0xA7, 0xD0, 0x0B, 0xFE, 0x00, 0xB8, 0xB4, 0x0B, 0x03, 0xD0, 0xA0, 0x1E, 0x0A, 0x00,
+    0xB8, 0xA0, 0x02, 0xD0
+};
+static const MicroFontGlyph font_digits20_glyphs[17] = {
+    { 0x0020,   0,   0,    0,    0,   6,      0 },  //  
+    { 0x002D,   6,   2,    1,    8,   8,      0 },  // -
+    { 0x002E,   3,   2,    1,   14,   4,      3 },  // .
+    { 0x0030,  10,  14,    1,    2,  12,      5 },  // 0
+    { 0x0031,   5,  14,    2,    2,  12,     40 },  // 1
+    { 0x0032,  10,  14,    1,    2,  12,     58 },  // 2
+    { 0x0033,  10,  14,    1,    2,  12,     93 },  // 3
+    { 0x0034,  10,  14,    1,    2,  12,    128 },  // 4
+    { 0x0035,  10,  14,    1,    2,  12,    163 },  // 5
+    { 0x0036,  10,  14,    1,    2,  12,    198 },  // 6
+    { 0x0037,  10,  14,    1,    2,  12,    233 },  // 7
+    { 0x0038,  10,  14,    1,    2,  12,    268 },  // 8
+    { 0x0039,  10,  14,    1,    2,  12,    303 },  // 9
+    { 0x0041,  13,  14,    0,    2,  13,    338 },  // A
+    { 0x0056,  13,  14,    0,    2,  13,    384 },  // V
+    { 0x0067,   9,  14,    1,    6,  11,    430 },  // g
+    { 0x006B,  10,  15,    1,    1,  11,    462 },  // k
+};
+static const MicroFontKern font_digits20_kerns[3] = {
+    { 0x0031, 0x0031, -1 },
+    { 0x0041, 0x0056, -2 },
+    { 0x0056, 0x0041, -2 }
+};
+static const MicroFont font_digits20 = { font_digits20_glyphs, font_digits20_bitmaps, font_digits20_kerns, 17, 3, 2, 20, 16 };
@@ -0,0 +1,162 @@
+// Generated by tools/micro_ui_font.py, do not edit.
+// bench_digits.ttf, 17 glyphs, 3 kerning pairs, 4 bpp: 2319 bytes of flash
+#pragma once
+#include "micro_ui.h"
+
+static const uint8_t font_digits28_bitmaps[2077] = {
+    0x39, 0x99, 0x99, 0x99, 0x55, 0xFF, 0xFF, 0xFF, 0xF8, 0x39, 0x99, 0x99, 0x99, 0x50, 0x4C, 0xC6,
+    0x5F, 0xF8, 0x5F, 0xF8, 0x00, 0x00, 0x15, 0x89, 0x85, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+    0xFD, 0x40, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x00, 0x1E, 0xFF, 0x71, 0x01, 0x9F,
+    0xFC, 0x00, 0x07, 0xFF, 0x60, 0x00, 0x00, 0x9F, 0xF4, 0x00, 0xCF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
+    0x90, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x9F, 0xF0,
+    0x4F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x15, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0x5F,
+    0xF3, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x24, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0x3F, 0xF5,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0x01, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x0D, 0xFB, 0x00,
+    0x00, 0x00, 0x0E, 0xFA, 0x00, 0x9F, 0xF3, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x03, 0xFF, 0xC1, 0x00,
+    0x03, 0xEF, 0xE1, 0x00, 0x0A, 0xFF, 0xE9, 0x8A, 0xFF, 0xF7, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x06, 0xBE, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x99, 0x50, 0x03, 0xDF,
+    0xF8, 0x04, 0xEF, 0xFF, 0x81, 0xFF, 0x9C, 0xF8, 0x1E, 0x50, 0xBF, 0x80, 0x20, 0x0B, 0xF8, 0x00,
+    0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF,
+    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00,
+    0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8,
+    0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x26,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x20, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xF2, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x05, 0xFA, 0x33, 0x33, 0x33, 0x33, 0x33, 0x20, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x25, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x15, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0xDF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE,
+    0xF2, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x23, 0x33, 0x33, 0x33, 0x33, 0x3D, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x4E, 0xEE, 0xEE,
+    0xEE, 0xEE, 0xEE, 0xFF, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x01, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x24,
+    0xFE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xF2, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x23,
+    0x33, 0x33, 0x33, 0x33, 0x3D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x71, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF2, 0x5F, 0xB6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x15, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x0B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x23, 0x33, 0x33, 0x33, 0x33, 0x3D, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x4E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF,
+    0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x15,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x5F, 0xB6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x15, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0xBB, 0xBB, 0xBB,
+    0xBB, 0xBB, 0x60, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0xFA, 0x33, 0x33, 0x33, 0x33,
+    0x3D, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2,
+    0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F,
+    0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x39, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x26, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x71, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x15, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF2, 0x5F, 0xB6, 0x66, 0x66, 0x66, 0x66, 0xDF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2,
+    0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x24, 0xFE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xF2, 0x2D,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0xFA, 0x33, 0x33, 0x33, 0x33, 0x3D, 0xF2, 0x5F, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0xFE, 0xEE, 0xEE, 0xEE,
+    0xEE, 0xFF, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x5F, 0xB6, 0x66, 0x66, 0x66, 0x66, 0xDF,
+    0x25, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x25, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x24, 0xFE, 0xBB,
+    0xBB, 0xBB, 0xBB, 0xBE, 0xF2, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x23, 0x33, 0x33,
+    0x33, 0x33, 0x3D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xF2, 0x4E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x03, 0x99, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xDE, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0x79, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x23, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x1E, 0xFB, 0x00, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF5, 0x00, 0x6F, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xE0, 0x00, 0x1E, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x09,
+    0xFF, 0x20, 0x00, 0x00, 0x09, 0xFF, 0x20, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x1E, 0xFB, 0x00,
+    0x00, 0x00, 0xCF, 0xE0, 0x00, 0x00, 0x6F, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF5, 0x00, 0x00, 0xCF,
+    0xFE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFB, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x20,
+    0x09, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x1E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xE0, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF5, 0xCF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFB, 0x89, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x98, 0x8F, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF1, 0x0B,
+    0xFE, 0x10, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0x40, 0x00, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0D, 0xFD, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x00,
+    0x4F, 0xF7, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0xAF, 0xF1, 0x00, 0x00, 0x0B, 0xFE, 0x10,
+    0x00, 0x01, 0xFF, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0xEF, 0xB0, 0x00, 0x0D, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF2, 0x00, 0x4F, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xAF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x01, 0xEF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x56, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBC,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFE, 0xC8, 0x10, 0x00, 0x1D,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xDA, 0x0A, 0xFF, 0xB5, 0x45, 0xAF, 0xFF, 0xB1, 0xFF, 0x90, 0x00, 0x00,
+    0x8F, 0xFB, 0x4F, 0xF3, 0x00, 0x00, 0x01, 0xFF, 0xB5, 0xFF, 0x10, 0x00, 0x00, 0x0E, 0xFB, 0x4F,
+    0xF2, 0x00, 0x00, 0x01, 0xFF, 0xB2, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0xFB, 0x0B, 0xFF, 0x82, 0x12,
+    0x7E, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x2A, 0xEF, 0xFF, 0xFA, 0x7F, 0xB0,
+    0x00, 0x00, 0x23, 0x20, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB2, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x5F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF9, 0x93, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x58, 0x82, 0x5F, 0xE0, 0x00, 0x00, 0x08,
+    0xFF, 0x60, 0x5F, 0xE0, 0x00, 0x01, 0xAF, 0xE4, 0x00, 0x5F, 0xE0, 0x00, 0x2C, 0xFE, 0x30, 0x00,
+    0x5F, 0xE0, 0x04, 0xEF, 0xD2, 0x00, 0x00, 0x5F, 0xE0, 0x6F, 0xFC, 0x10, 0x00, 0x00, 0x5F, 0xE9,
+    0xFF, 0xFD, 0x10, 0x00, 0x00, 0x5F, 0xFF, 0xFD, 0xFF, 0x90, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0xBF,
+    0xF5, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x2E, 0xFE, 0x10, 0x00, 0x5F, 0xE0, 0x00, 0x05, 0xFF, 0xB0,
+    0x00, 0x5F, 0xE0, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x0C, 0xFE, 0x20, 0x5F,
+    0xE0, 0x00, 0x00, 0x02, 0xEF, 0xC0, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x5F, 0xF7
+};
+static const MicroFontGlyph font_digits28_glyphs[17] = {
+    { 0x0020,   0,   0,    0,    0,   8,      0 },  //  
+    { 0x002D,   9,   3,    1,   12,  11,      0 },  // -
+    { 0x002E,   4,   3,    1,   20,   6,     14 },  // .
+    { 0x0030,  15,  20,    1,    3,  17,     20 },  // 0
+    { 0x0031,   7,  20,    3,    3,  17,    170 },  // 1
+    { 0x0032,  15,  20,    1,    3,  17,    240 },  // 2
+    { 0x0033,  15,  20,    1,    3,  17,    390 },  // 3
+    { 0x0034,  15,  20,    1,    3,  17,    540 },  // 4
+    { 0x0035,  15,  20,    1,    3,  17,    690 },  // 5
+    { 0x0036,  15,  20,    1,    3,  17,    840 },  // 6
+    { 0x0037,  15,  20,    1,    3,  17,    990 },  // 7
+    { 0x0038,  15,  20,    1,    3,  17,   1140 },  // 8
+    { 0x0039,  15,  20,    1,    3,  17,   1290 },  // 9
+    { 0x0041,  18,  20,    0,    3,  18,   1440 },  // A
+    { 0x0056,  18,  20,    0,    3,  18,   1620 },  // V
+    { 0x0067,  13,  20,    1,    9,  16,   1800 },  // g
+    { 0x006B,  14,  21,    1,    2,  15,   1930 },  // k
+};
+static const MicroFontKern font_digits28_kerns[3] = {
+    { 0x0031, 0x0031, -2 },
+    { 0x0041, 0x0056, -3 },
+    { 0x0056, 0x0041, -3 }
+};
+static const MicroFont font_digits28 = { font_digits28_glyphs, font_digits28_bitmaps, font_digits28_kerns, 17, 3, 4, 29, 23 };
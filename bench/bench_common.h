@@ -0,0 +1,24 @@
+// Helpers shared by the host benchmark and golden-image harnesses
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <micro_ui.h>
+
+#define LOOP_US     5000    // Virtual time between loop() passes
+
+// Smallest raw reading that getTouch() maps onto screen pixel `p`.
+inline int16_t rawFor(int p, int rawMin, int rawMax, int span) {
+    return rawMin + (p * (rawMax - rawMin) + span - 1) / span;
+}
+
+inline void touchAt(int x, int y) {
+    touchscreen.hostTouch(rawFor(x, MIN_TOUCH_X, MAX_TOUCH_X, SCREEN_WIDTH),
+                          rawFor(y, MIN_TOUCH_Y, MAX_TOUCH_Y, SCREEN_HEIGHT));
+}
+
+inline void loopOnce() {
+    hostAdvanceMicros(LOOP_US);
+    microUILoopHandler();
+}
+
+#endif
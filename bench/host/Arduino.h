@@ -0,0 +1,98 @@
+// Host stand-in for the Arduino core: a controllable clock, a Serial
+// that writes to stdout and the handful of helpers micro_ui uses.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Host time is virtual: it only moves when a benchmark or test says so,
+// which keeps every run deterministic.
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void hostAdvanceMicros(unsigned long us);
+void hostSetMicros(unsigned long us);
+
+#define OUTPUT  1
+#define INPUT   0
+#define LOW     0
+#define HIGH    1
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t len) {
+        size_t n = 0;
+        while (len--) n += write(*buf++);
+        return n;
+    }
+    size_t print(const char* s)             { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(char c)                    { return write((uint8_t)c); }
+    size_t print(int v)                     { return printf("%d", v); }
+    size_t print(unsigned v)                { return printf("%u", v); }
+    size_t print(long v)                    { return printf("%ld", v); }
+    size_t print(unsigned long v)           { return printf("%lu", v); }
+    size_t print(double v, int digits = 2)  { return printf("%.*f", digits, v); }
+    size_t println()                        { return print("\r\n"); }
+    template <typename T> size_t println(T v)             { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(T v, int digits) { size_t n = print(v, digits); return n + println(); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(buf, sizeof(buf), fmt, args);
+        va_end(args);
+        if (n < 0) return 0;
+        return write((const uint8_t*)buf, min((size_t)n, sizeof(buf) - 1));
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+};
+
+class HostSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+    operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
+
+// Cycle counter for the profiler: host nanoseconds scaled to a
+// nominal 240 MHz core.
+class HostEsp {
+public:
+    uint32_t getCycleCount();
+};
+extern HostEsp ESP;
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+
+#include "freertos/FreeRTOS.h"
+
+#endif
@@ -0,0 +1,16 @@
+// Host stand-in for the Arduino SPI class
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define VSPI 3
+#define HSPI 2
+
+class SPIClass {
+public:
+    explicit SPIClass(uint8_t bus = VSPI) { (void)bus; }
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) { (void)sck; (void)miso; (void)mosi; (void)ss; }
+};
+
+#endif
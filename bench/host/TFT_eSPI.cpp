@@ -0,0 +1,514 @@
+// Host framebuffer implementation of the TFT_eSPI subset used by micro_ui
+#include "TFT_eSPI.h"
+
+HostDisplayStats hostDisplayStats = {};
+uint32_t hostPanelSpiHz = 0;
+
+// Bus time of panel traffic: 16 bits per pixel, and 11 bytes of CASET,
+// RASET and RAMWR per window. Fractions of a microsecond carry over.
+static uint64_t pending = 0;            // Bit-microseconds not yet a whole microsecond
+
+void hostBusTimeReset() {
+    pending = 0;
+}
+
+static void hostBusTime(uint64_t windows, uint64_t pixels) {
+    if (!hostPanelSpiHz) return;
+    pending += (windows * 88 + pixels * 16) * 1000000;
+    hostAdvanceMicros((unsigned long)(pending / hostPanelSpiHz));
+    pending %= hostPanelSpiHz;
+}
+
+struct HostFontMetrics { uint8_t font; int16_t w, h; };
+
+// Rough advance widths and heights of the TFT_eSPI built-in fonts.
+static const HostFontMetrics hostFonts[] = {
+    { 1,  6,  8 },
+    { 2,  8, 16 },
+    { 4, 14, 26 },
+    { 6, 24, 48 },
+    { 7, 32, 48 },
+    { 8, 55, 75 },
+};
+
+static HostFontMetrics fontMetrics(uint8_t font) {
+    for (const HostFontMetrics &m : hostFonts) {
+        if (m.font == font) return m;
+    }
+    return hostFonts[0];
+}
+
+// ===== TFT_eSPI =====
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _width(w), _height(h), _nativeW(w), _nativeH(h) {
+    if (w > 0 && h > 0) {
+        _fb = new uint16_t[(size_t)w * h]();
+    }
+    resetViewport();
+}
+
+TFT_eSPI::~TFT_eSPI() {
+    delete[] _fb;
+}
+
+void TFT_eSPI::init() {
+    _rotation = 0;
+    _width = _nativeW;
+    _height = _nativeH;
+    resetViewport();
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+    _rotation = r & 3;
+    bool swap = _rotation & 1;
+    _width  = swap ? _nativeH : _nativeW;
+    _height = swap ? _nativeW : _nativeH;
+    resetViewport();
+}
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+    _xDatum = vpDatum ? x : 0;
+    _yDatum = vpDatum ? y : 0;
+    _vpX = max<int32_t>(x, 0);
+    _vpY = max<int32_t>(y, 0);
+    _vpW = min<int32_t>(x + w, _width);
+    _vpH = min<int32_t>(y + h, _height);
+}
+
+void TFT_eSPI::resetViewport() {
+    _vpX = _vpY = 0;
+    _xDatum = _yDatum = 0;
+    _vpW = _width;
+    _vpH = _height;
+}
+
+// False when nothing of the box is left.
+bool TFT_eSPI::clipAddrWindow(int32_t* x, int32_t* y, int32_t* w, int32_t* h) {
+    if (*x < _vpX) { *w -= _vpX - *x; *x = _vpX; }
+    if (*y < _vpY) { *h -= _vpY - *y; *y = _vpY; }
+    if (*x + *w > _vpW) *w = _vpW - *x;
+    if (*y + *h > _vpH) *h = _vpH - *y;
+    return *w > 0 && *h > 0;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    x += _xDatum;
+    y += _yDatum;
+    if (x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return;
+    _fb[y * _width + x] = color;
+    hostDisplayStats.pixels++;
+    hostDisplayStats.windows++;
+    hostBusTime(1, 1);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    x += _xDatum;
+    y += _yDatum;
+    if (!clipAddrWindow(&x, &y, &w, &h)) return;
+
+    for (int32_t row = y; row < y + h; row++) {
+        uint16_t* p = &_fb[row * _width + x];
+        for (int32_t i = 0; i < w; i++) p[i] = color;
+    }
+    hostDisplayStats.pixels += (uint64_t)w * h;
+    hostDisplayStats.windows++;
+    hostBusTime(1, (uint64_t)w * h);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    return _fb[y * _width + x];
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+    for (;;) {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+// Same scanline split as the Adafruit GFX / TFT_eSPI implementation.
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+    int32_t a, b, y, last;
+    if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+    if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+    if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+    if (y0 == y2) {
+        a = b = x0;
+        if (x1 < a) a = x1; else if (x1 > b) b = x1;
+        if (x2 < a) a = x2; else if (x2 > b) b = x2;
+        drawFastHLine(a, y0, b - a + 1, color);
+        return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1, sa = 0, sb = 0;
+
+    last = (y1 == y2) ? y1 : y1 - 1;
+    for (y = y0; y <= last; y++) {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b) std::swap(a, b);
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+
+    sa = dx12 * (y - y1);
+    sb = dx02 * (y - y0);
+    for (; y <= y2; y++) {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b) std::swap(a, b);
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    int32_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r;
+    drawPixel(x0, y0 + r, color);
+    drawPixel(x0, y0 - r, color);
+    drawPixel(x0 + r, y0, color);
+    drawPixel(x0 - r, y0, color);
+    while (x < y) {
+        if (f >= 0) { y--; ddy += 2; f += ddy; }
+        x++; ddx += 2; f += ddx;
+        drawPixel(x0 + x, y0 + y, color); drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 + x, y0 - y, color); drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + y, y0 + x, color); drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 + y, y0 - x, color); drawPixel(x0 - y, y0 - x, color);
+    }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    for (int32_t dy = -r; dy <= r; dy++) {
+        int32_t dx = (int32_t)sqrt((double)(r * r - dy * dy));
+        drawFastHLine(x0 - dx, y0 + dy, 2 * dx + 1, color);
+    }
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    _winX = x; _winY = y; _winW = w; _winH = h; _winPos = 0;
+    hostDisplayStats.windows++;
+    hostBusTime(1, 0);
+}
+
+void TFT_eSPI::windowPixel(uint16_t color) {
+    if (_winW <= 0 || _winPos >= _winW * _winH) return;
+    int32_t x = _winX + _winPos % _winW;
+    int32_t y = _winY + _winPos / _winW;
+    _winPos++;
+    hostDisplayStats.pixels++;
+    hostBusTime(0, 1);
+    if (x >= 0 && y >= 0 && x < _width && y < _height) _fb[y * _width + x] = color;
+}
+
+void TFT_eSPI::pushColor(uint16_t color) {
+    windowPixel(color);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len) {
+    while (len--) windowPixel(color);
+}
+
+void TFT_eSPI::pushColors(const uint16_t* data, uint32_t len, bool swap) {
+    while (len--) {
+        uint16_t c = *data++;
+        windowPixel(swap ? (uint16_t)((c >> 8) | (c << 8)) : c);
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    x += _xDatum;
+    y += _yDatum;
+    int32_t cx = x, cy = y, cw = w, ch = h;
+    if (!clipAddrWindow(&cx, &cy, &cw, &ch)) return;
+    setAddrWindow(cx, cy, cw, ch);
+    for (int32_t row = cy; row < cy + ch; row++) pushColors(&data[(row - y) * w + (cx - x)], cw);
+}
+
+// Only the vertical scroll commands are decoded; their parameters are
+// big-endian 16-bit words.
+void TFT_eSPI::writecommand(uint8_t c) {
+    _lastCommand = c;
+    _commandBytes = 0;
+}
+
+void TFT_eSPI::writedata(uint8_t d) {
+    if (_lastCommand != 0x33 && _lastCommand != 0x37) return;
+    _commandWord = (uint16_t)((_commandWord << 8) | d);
+    if (++_commandBytes & 1) return;
+
+    if (_lastCommand == 0x37) {
+        hostScrollStart = _commandWord;
+    } else if (_commandBytes == 2) {
+        hostScrollTop = _commandWord;
+    } else if (_commandBytes == 4) {
+        hostScrollArea = _commandWord;
+    }
+}
+
+// Display line k inside the scroll area shows frame memory line
+// top + (start - top + k) % area.
+void TFT_eSPI::hostScanout(uint16_t* out) const {
+    if (_rotation == 1) {
+        for (int32_t y = 0; y < _height; y++) {
+            for (int32_t x = 0; x < _width; x++) {
+                int32_t src = x;
+                if (hostScrollArea && x >= hostScrollTop && x < hostScrollTop + hostScrollArea) {
+                    src = hostScrollTop + (hostScrollStart - hostScrollTop + (x - hostScrollTop)) % hostScrollArea;
+                }
+                out[y * _width + x] = _fb[y * _width + src];
+            }
+        }
+        return;
+    }
+    for (int32_t y = 0; y < _height; y++) {
+        int32_t src = y;
+        if (_rotation == 0 && hostScrollArea && y >= hostScrollTop && y < hostScrollTop + hostScrollArea) {
+            src = hostScrollTop + (hostScrollStart - hostScrollTop + (y - hostScrollTop)) % hostScrollArea;
+        }
+        memcpy(&out[y * _width], &_fb[src * _width], _width * sizeof(uint16_t));
+    }
+}
+
+int16_t TFT_eSPI::textWidth(const char* s) {
+    return textWidth(s, _font);
+}
+
+int16_t TFT_eSPI::textWidth(const char* s, uint8_t font) {
+    return s ? (int16_t)(strlen(s) * fontMetrics(font).w) : 0;
+}
+
+int16_t TFT_eSPI::fontHeight() {
+    return fontHeight(_font);
+}
+
+int16_t TFT_eSPI::fontHeight(uint8_t font) {
+    return fontMetrics(font).h;
+}
+
+// Glyphs are a cell background plus one bar per set bit of the
+// character code: meaningless to read, but deterministic and costed
+// like real text.
+void TFT_eSPI::drawGlyph(int32_t x, int32_t y, char c, int16_t cw, int16_t ch) {
+    if (_textBg != _textColor) fillRect(x, y, cw, ch, _textBg);
+    int16_t bar = max<int16_t>(1, cw / 8);
+    for (int bit = 0; bit < 8; bit++) {
+        if ((uint8_t)c & (1 << bit)) fillRect(x + bit * bar, y + 1, bar, ch - 2, _textColor);
+    }
+}
+
+int16_t TFT_eSPI::drawString(const char* s, int32_t x, int32_t y) {
+    return drawString(s, x, y, _font);
+}
+
+int16_t TFT_eSPI::drawString(const char* s, int32_t x, int32_t y, uint8_t font) {
+    if (!s) return 0;
+    HostFontMetrics m = fontMetrics(font);
+    int16_t w = textWidth(s, font);
+
+    switch (_datum % 3) {
+        case 1: x -= w / 2; break;
+        case 2: x -= w; break;
+    }
+    switch (_datum / 3) {
+        case 1: y -= m.h / 2; break;
+        case 2: y -= m.h; break;
+    }
+    for (const char* p = s; *p; p++, x += m.w) drawGlyph(x, y, *p, m.w, m.h);
+    return w;
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t c, int32_t x, int32_t y, uint8_t font) {
+    HostFontMetrics m = fontMetrics(font);
+    drawGlyph(x, y, (char)c, m.w, m.h);
+    return m.w;
+}
+
+// Font 1 cell at the given scale, in explicit colours.
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    uint16_t fg = _textColor, back = _textBg;
+    _textColor = color;
+    _textBg = bg;
+    HostFontMetrics m = fontMetrics(1);
+    drawGlyph(x, y, (char)c, m.w * size, m.h * size);
+    _textColor = fg;
+    _textBg = back;
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    HostFontMetrics m = fontMetrics(_font);
+    if (c == '\n') {
+        _cursorX = 0;
+        _cursorY += m.h;
+        return 1;
+    }
+    drawGlyph(_cursorX, _cursorY, c, m.w, m.h);
+    _cursorX += m.w;
+    return 1;
+}
+
+uint8_t TFT_eSPI::color16to8(uint16_t c) const {
+    return ((c & 0xE000) >> 8) | ((c & 0x0700) >> 6) | ((c & 0x0018) >> 3);
+}
+
+uint16_t TFT_eSPI::color8to16(uint8_t c) const {
+    static const uint8_t blue[] = { 0, 11, 21, 31 };
+    uint16_t c16 = (c & 0x1C) << 6 | (c & 0xC0) << 5 | (c & 0xE0) << 8;
+    return c16 | (c & 0x1C) << 3 | blue[c & 0x03];
+}
+
+// ===== TFT_eSprite =====
+TFT_eSprite::TFT_eSprite(TFT_eSPI* parent)
+    : TFT_eSPI(0, 0), _parent(parent) {
+    for (int i = 0; i < 16; i++) _palette[i] = i * 0x1111;
+}
+
+TFT_eSprite::~TFT_eSprite() {
+    deleteSprite();
+}
+
+void* TFT_eSprite::setColorDepth(int8_t bits) {
+    _bpp = (bits == 8 || bits == 4) ? bits : 16;
+    if (_pixels) {
+        int16_t w = _width, h = _height;
+        deleteSprite();
+        return createSprite(w, h);
+    }
+    return nullptr;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t) {
+    if (_pixels) return _pixels;
+    if (w <= 0 || h <= 0) return nullptr;
+    _width = _nativeW = w;
+    _height = _nativeH = h;
+    resetViewport();
+    _pixels = new uint8_t[(size_t)w * h * (_bpp == 16 ? 2 : 1)]();
+    return _pixels;
+}
+
+void TFT_eSprite::deleteSprite() {
+    delete[] _pixels;
+    _pixels = nullptr;
+}
+
+void TFT_eSprite::createPalette(const uint16_t* palette, uint8_t colors) {
+    for (int i = 0; i < 16 && i < colors; i++) _palette[i] = palette ? palette[i] : 0;
+}
+
+void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color) {
+    _palette[index & 15] = color;
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    fillRect(x, y, 1, 1, color);
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    x += _xDatum;
+    y += _yDatum;
+    if (!_pixels || !clipAddrWindow(&x, &y, &w, &h)) return;
+
+    for (int32_t row = y; row < y + h; row++) {
+        for (int32_t col = x; col < x + w; col++) store((size_t)row * _width + col, color);
+    }
+    hostDisplayStats.spritePixels += (uint64_t)w * h;
+}
+
+void TFT_eSprite::store(size_t i, uint32_t color) {
+    if (_bpp == 16)     ((uint16_t*)_pixels)[i] = color;
+    else if (_bpp == 8) _pixels[i] = color16to8(color);
+    else                _pixels[i] = color & 15;
+}
+
+uint16_t TFT_eSprite::expand(int32_t x, int32_t y) const {
+    size_t i = (size_t)y * _width + x;
+    if (_bpp == 16) return ((const uint16_t*)_pixels)[i];
+    if (_bpp == 8)  return color8to16(_pixels[i]);
+    return _palette[_pixels[i] & 15];
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+    if (!_pixels || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    return expand(x, y);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    pushSprite(x, y, 0, 0, _width, _height);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+    if (!_pixels) return;
+    for (int32_t sy = 0; sy < _height; sy++) {
+        int32_t run = -1;
+        for (int32_t sx = 0; sx <= _width; sx++) {
+            bool solid = sx < _width && expand(sx, sy) != transparent;
+            if (solid && run < 0) run = sx;
+            if (!solid && run >= 0) {
+                int32_t cx = x + run, cy = y + sy, cw = sx - run, ch = 1;
+                if (_parent->clipAddrWindow(&cx, &cy, &cw, &ch)) {
+                    _parent->setAddrWindow(cx, cy, cw, 1);
+                    for (int32_t i = cx - x; i < cx - x + cw; i++) _parent->pushColor(expand(i, sy));
+                }
+                run = -1;
+            }
+        }
+    }
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+    if (!_pixels) return false;
+    if (sx < 0) { sw += sx; tx -= sx; sx = 0; }
+    if (sy < 0) { sh += sy; ty -= sy; sy = 0; }
+    if (sx + sw > _width)  sw = _width - sx;
+    if (sy + sh > _height) sh = _height - sy;
+    if (sw <= 0 || sh <= 0) return false;
+
+    int32_t cx = tx, cy = ty;
+    if (!_parent->clipAddrWindow(&cx, &cy, &sw, &sh)) return false;
+    sx += cx - tx;
+    sy += cy - ty;
+    tx = cx;
+    ty = cy;
+
+    _parent->setAddrWindow(tx, ty, sw, sh);
+    for (int32_t row = sy; row < sy + sh; row++) {
+        for (int32_t col = sx; col < sx + sw; col++) _parent->pushColor(expand(col, row));
+    }
+    return true;
+}
+
+bool TFT_eSprite::pushToSprite(TFT_eSprite* dspr, int32_t x, int32_t y) {
+    if (!_pixels || !dspr || _bpp != 16 || dspr->_bpp != 16) return false;
+    dspr->pushImage(x, y, _width, _height, (const uint16_t*)_pixels);
+    return true;
+}
+
+void TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    x += _xDatum;
+    y += _yDatum;
+    int32_t cx = x, cy = y, cw = w, ch = h;
+    if (!_pixels || !clipAddrWindow(&cx, &cy, &cw, &ch)) return;
+    for (int32_t row = cy; row < cy + ch; row++) {
+        for (int32_t col = cx; col < cx + cw; col++) store((size_t)row * _width + col, data[(row - y) * w + (col - x)]);
+    }
+    hostDisplayStats.spritePixels += (uint64_t)cw * ch;
+}
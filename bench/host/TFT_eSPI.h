@@ -0,0 +1,204 @@
+// Host stand-in for TFT_eSPI. Draws into an RGB565 framebuffer and
+// counts every pixel that would have crossed the SPI bus, so micro_ui
+// can be benchmarked and pixel-checked without a panel.
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+#include <Arduino.h>
+
+#define TFT_WIDTH           240
+#define TFT_HEIGHT          320
+
+#define TFT_BLACK           0x0000
+#define TFT_NAVY            0x000F
+#define TFT_DARKGREEN       0x03E0
+#define TFT_MAROON          0x7800
+#define TFT_PURPLE          0x780F
+#define TFT_OLIVE           0x7BE0
+#define TFT_LIGHTGREY       0xD69A
+#define TFT_DARKGREY        0x7BEF
+#define TFT_BLUE            0x001F
+#define TFT_GREEN           0x07E0
+#define TFT_CYAN            0x07FF
+#define TFT_RED             0xF800
+#define TFT_MAGENTA         0xF81F
+#define TFT_YELLOW          0xFFE0
+#define TFT_WHITE           0xFFFF
+#define TFT_ORANGE          0xFDA0
+#define TFT_TRANSPARENT     0x0120
+
+#define TL_DATUM            0
+#define TC_DATUM            1
+#define TR_DATUM            2
+#define ML_DATUM            3
+#define MC_DATUM            4
+#define MR_DATUM            5
+#define BL_DATUM            6
+#define BC_DATUM            7
+#define BR_DATUM            8
+
+// Everything the panel would have been sent since the last reset.
+struct HostDisplayStats {
+    uint64_t pixels;        // Pixels written to the panel
+    uint64_t windows;       // Address windows opened (one per SPI burst)
+    uint64_t spritePixels;  // Pixels written into off-screen sprites
+};
+extern HostDisplayStats hostDisplayStats;
+
+// Panel SPI clock. When non-zero, panel traffic advances the virtual
+// clock (micros()) by its bus time, so timings taken around draws follow
+// the bytes sent and are the same on every run. Off by default.
+extern uint32_t hostPanelSpiHz;
+
+// Drops the fraction of a microsecond carried between draws, so a
+// replay from a reset clock times exactly like the first run.
+void hostBusTimeReset();
+
+class TFT_eSPI : public Print {
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI();
+
+    void     init();
+    void     begin() { init(); }
+    void     setRotation(uint8_t r);
+    uint8_t  getRotation() const { return _rotation; }
+    int16_t  width() const { return _width; }
+    int16_t  height() const { return _height; }
+
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    virtual uint16_t readPixel(int32_t x, int32_t y);
+
+    void     fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+    void     drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    // Virtual like fillRect() and drawPixel(), as on the real library,
+    // where TFT_eSprite overrides them too
+    virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+    virtual void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void     fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+    void     drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void     fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+
+    // Raw pixel streaming, as used for sprites and images
+    void     startWrite() {}
+    void     endWrite() {}
+    void     setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void     pushColor(uint16_t color);
+    void     pushColor(uint16_t color, uint32_t len);
+    void     pushColors(const uint16_t* data, uint32_t len, bool swap = false);
+    void     pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+    void     writecommand(uint8_t c);
+    void     writedata(uint8_t d);
+
+    // Draws are clipped to the viewport; setAddrWindow() is not, as on
+    // the real library. With vpDatum, drawing coordinates start at the
+    // viewport's corner; raw windows and sprite pushes stay
+    // screen-relative.
+    void     setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+    void     resetViewport();
+    bool     clipAddrWindow(int32_t* x, int32_t* y, int32_t* w, int32_t* h);
+
+    // Text
+    void     setTextColor(uint16_t color) { _textColor = color; _textBg = color; }
+    void     setTextColor(uint16_t color, uint16_t bg) { _textColor = color; _textBg = bg; }
+    void     setTextFont(uint8_t font) { _font = font; }
+    void     setTextSize(uint8_t) {}
+    void     setTextDatum(uint8_t datum) { _datum = datum; }
+    uint8_t  getTextDatum() const { return _datum; }
+    void     setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    int16_t  textWidth(const char* s);
+    int16_t  textWidth(const char* s, uint8_t font);
+    int16_t  fontHeight();
+    int16_t  fontHeight(uint8_t font);
+    int16_t  drawString(const char* s, int32_t x, int32_t y);
+    int16_t  drawString(const char* s, int32_t x, int32_t y, uint8_t font);
+    virtual int16_t drawChar(uint16_t c, int32_t x, int32_t y, uint8_t font);
+    virtual void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+    size_t   write(uint8_t c) override;
+    using Print::write;
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) const {
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+    uint8_t  color16to8(uint16_t c) const;
+    uint16_t color8to16(uint8_t c) const;
+
+    // Host access to the panel contents
+    const uint16_t* framebuffer() const { return _fb; }
+
+    // Vertical scroll registers (VSCRDEF, VSCRSADD). framebuffer() is
+    // frame memory; hostScanout() is what the panel shows, which only
+    // differs once a scroll area is set. The registers work along the
+    // native 320 line axis: down the screen in rotation 0, left to right
+    // in rotation 1.
+    uint16_t hostScrollTop = 0;
+    uint16_t hostScrollArea = TFT_HEIGHT;
+    uint16_t hostScrollStart = 0;
+    void     hostScanout(uint16_t* out) const;
+
+protected:
+    void     drawGlyph(int32_t x, int32_t y, char c, int16_t cw, int16_t ch);
+    void     windowPixel(uint16_t color);
+
+    int16_t  _width, _height;
+    int16_t  _nativeW, _nativeH;
+    uint8_t  _rotation = 0;
+    uint16_t* _fb = nullptr;
+    int32_t  _vpX = 0, _vpY = 0, _vpW = 0, _vpH = 0;   // Viewport, right and bottom exclusive
+    int32_t  _xDatum = 0, _yDatum = 0;
+
+    uint16_t _textColor = TFT_WHITE;
+    uint16_t _textBg = TFT_WHITE;
+    uint8_t  _font = 1;
+    uint8_t  _datum = TL_DATUM;
+    int16_t  _cursorX = 0, _cursorY = 0;
+
+    int32_t  _winX = 0, _winY = 0, _winW = 0, _winH = 0, _winPos = 0;
+    uint8_t  _lastCommand = 0;
+    int      _commandBytes = 0;
+    uint16_t _commandWord = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI* parent);
+    ~TFT_eSprite() override;
+
+    void*    createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void     deleteSprite();
+    bool     created() const { return _pixels != nullptr; }
+    void*    setColorDepth(int8_t bits);
+    int8_t   getColorDepth() const { return _bpp; }
+    void     fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void     drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void     fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+    uint16_t readPixel(int32_t x, int32_t y) override;
+
+    void     pushSprite(int32_t x, int32_t y);
+    void     pushSprite(int32_t x, int32_t y, uint16_t transparent);
+    bool     pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+    // Sprite to sprite. As on the real library only 16-bit into 16-bit
+    // is covered here; both clip to the destination's viewport.
+    bool     pushToSprite(TFT_eSprite* dspr, int32_t x, int32_t y);
+    void     pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    // 4-bit sprites look colours up in a 16 entry palette
+    void     createPalette(const uint16_t* palette, uint8_t colors = 16);
+    void     setPaletteColor(uint8_t index, uint16_t color);
+    uint16_t getPaletteColor(uint8_t index) const { return _palette[index & 15]; }
+
+private:
+    void     store(size_t i, uint32_t color);
+    uint16_t expand(int32_t x, int32_t y) const;
+
+    TFT_eSPI* _parent;
+    uint8_t*  _pixels = nullptr;
+    int8_t    _bpp = 16;
+    uint16_t  _palette[16];
+};
+
+#endif
@@ -0,0 +1,32 @@
+// Host stand-in for the XPT2046 driver. Benchmarks and tests script
+// touches with hostTouch()/hostRelease() in raw controller units.
+#ifndef HOST_XPT2046_TOUCHSCREEN_H
+#define HOST_XPT2046_TOUCHSCREEN_H
+
+#include <Arduino.h>
+#include "SPI.h"
+
+class TS_Point {
+public:
+    TS_Point() : x(0), y(0), z(0) {}
+    TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+    int16_t x, y, z;
+};
+
+class XPT2046_Touchscreen {
+public:
+    XPT2046_Touchscreen(uint8_t cs, uint8_t irq = 255) { (void)cs; (void)irq; }
+    bool begin(SPIClass&) { return true; }
+    void setRotation(uint8_t) {}
+    bool touched() { return _touched; }
+    TS_Point getPoint() { return _point; }
+
+    void hostTouch(int16_t rawX, int16_t rawY) { _touched = true; _point = TS_Point(rawX, rawY, 1000); }
+    void hostRelease() { _touched = false; }
+
+private:
+    bool     _touched = false;
+    TS_Point _point;
+};
+
+#endif
@@ -0,0 +1,36 @@
+// Host stand-in for the FreeRTOS calls micro_ui makes. Tasks run on
+// std::thread; notifications are a counting semaphore per task.
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int         BaseType_t;
+typedef unsigned    UBaseType_t;
+typedef uint32_t    TickType_t;
+typedef struct HostTask* TaskHandle_t;
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              1
+#define portMAX_DELAY       0xffffffffUL
+#define configMAX_PRIORITIES 25
+#define tskNO_AFFINITY      -1
+
+BaseType_t  xTaskCreate(void (*fn)(void*), const char* name, uint32_t stack, void* arg, UBaseType_t prio, TaskHandle_t* out);
+BaseType_t  xTaskCreatePinnedToCore(void (*fn)(void*), const char* name, uint32_t stack, void* arg, UBaseType_t prio, TaskHandle_t* out, int core);
+BaseType_t  xTaskNotifyGive(TaskHandle_t task);
+uint32_t    ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait);
+void        vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+// Critical sections map to one host mutex per portMUX.
+struct portMUX_TYPE { void* impl; };
+#define portMUX_INITIALIZER_UNLOCKED { nullptr }
+void hostMuxLock(portMUX_TYPE* mux);
+void hostMuxUnlock(portMUX_TYPE* mux);
+#define portENTER_CRITICAL(mux)   hostMuxLock(mux)
+#define portEXIT_CRITICAL(mux)    hostMuxUnlock(mux)
+
+#endif
@@ -0,0 +1,87 @@
+// Host runtime: virtual clock, Serial and FreeRTOS task emulation
+#include <Arduino.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+HostSerial Serial;
+HostEsp    ESP;
+
+uint32_t HostEsp::getCycleCount() {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return (uint32_t)(ns * 240 / 1000);
+}
+
+static unsigned long long hostNowUs = 0;
+
+unsigned long millis()                  { return (unsigned long)(hostNowUs / 1000); }
+unsigned long micros()                  { return (unsigned long)hostNowUs; }
+void delay(unsigned long ms)            { hostNowUs += (unsigned long long)ms * 1000; }
+void delayMicroseconds(unsigned int us) { hostNowUs += us; }
+void hostAdvanceMicros(unsigned long us){ hostNowUs += us; }
+void hostSetMicros(unsigned long us)    { hostNowUs = us; }
+
+// ===== FreeRTOS emulation =====
+struct HostTask {
+    std::mutex              lock;
+    std::condition_variable wake;
+    uint32_t                notified = 0;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t* out, int) {
+    HostTask* task = new HostTask();
+    if (out) *out = task;
+    std::thread([fn, arg, task]() {
+        currentTask = task;
+        fn(arg);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(void (*fn)(void*), const char* name, uint32_t stack, void* arg, UBaseType_t prio, TaskHandle_t* out) {
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, out, tskNO_AFFINITY);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return pdFALSE;
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notified++;
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t) {
+    HostTask* task = currentTask;
+    if (!task) return 0;
+    std::unique_lock<std::mutex> guard(task->lock);
+    task->wake.wait(guard, [task]() { return task->notified > 0; });
+    uint32_t count = task->notified;
+    task->notified = clearOnExit ? 0 : count - 1;
+    return count;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return currentTask;
+}
+
+static std::mutex muxCreate;
+
+void hostMuxLock(portMUX_TYPE* mux) {
+    {
+        std::lock_guard<std::mutex> guard(muxCreate);
+        if (!mux->impl) mux->impl = new std::recursive_mutex();
+    }
+    static_cast<std::recursive_mutex*>(mux->impl)->lock();
+}
+
+void hostMuxUnlock(portMUX_TYPE* mux) {
+    static_cast<std::recursive_mutex*>(mux->impl)->unlock();
+}
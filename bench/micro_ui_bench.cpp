@@ -0,0 +1,528 @@
+// Host benchmarks for micro_ui and the load cell filter chain.
+//
+// micro_ui is built against the stub display in host/, which counts
+// every pixel and address window the panel would have been sent, so
+// each scenario reports host ns/op next to the SPI traffic it caused.
+// Host time is not ESP32 time; compare runs on the same machine and
+// treat pixels/op and windows/op as the portable numbers. Runs made
+// with hostPanelSpiHz set also report the panel bus time they cost.
+//
+//   micro_ui_bench [--quick] [--json out.json] [--trace hc12.log] [--filter name]
+#include "bench_common.h"
+#include "assets/bench_images.h"
+#include "assets/font_digits28.h"
+#include "loadcell_filter.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Same defaults as the example firmware.
+CalibrationData config = {
+    .capacity         = 1,
+    .divisions        = 3000,
+    .dp               = 2,
+    .zero_raw         = 9590,
+    .cal_kg           = 1,
+    .cal_raw          = 1088000,
+    .fso_raw          = 1088000,
+    .meanSlider       = 0,
+    .filterSlider     = 70,
+    .vibrationSlider  = 0,
+    .lockingSlider    = 50
+};
+
+struct BenchResult {
+    std::string name;
+    uint64_t    ops;
+    double      nsPerOp;
+    double      pixelsPerOp;
+    double      windowsPerOp;
+    double      spritePixelsPerOp;
+    double      bytesPerOp;     // RGB565 bytes on the SPI bus
+    double      busUsPerOp;     // Bus time at hostPanelSpiHz, 0 if unset
+};
+
+static std::vector<BenchResult> results;
+static bool         quick       = false;
+static const char*  onlyBench   = nullptr;
+
+typedef std::chrono::steady_clock BenchClock;
+
+struct BenchRun {
+    const char*         name;
+    BenchClock::time_point start;
+    HostDisplayStats    before;
+    unsigned long       busStart;
+
+    explicit BenchRun(const char* name) : name(name), start(BenchClock::now()), before(hostDisplayStats), busStart(micros()) {}
+
+    void finish(uint64_t ops) {
+        double ns = std::chrono::duration<double, std::nano>(BenchClock::now() - start).count();
+        BenchResult r;
+        r.name              = name;
+        r.ops               = ops;
+        r.nsPerOp           = ops ? ns / ops : 0;
+        r.pixelsPerOp       = ops ? double(hostDisplayStats.pixels - before.pixels) / ops : 0;
+        r.windowsPerOp      = ops ? double(hostDisplayStats.windows - before.windows) / ops : 0;
+        r.spritePixelsPerOp = ops ? double(hostDisplayStats.spritePixels - before.spritePixels) / ops : 0;
+        r.bytesPerOp        = r.pixelsPerOp * 2;
+        r.busUsPerOp        = ops && hostPanelSpiHz ? double(micros() - busStart) / ops : 0;
+        results.push_back(r);
+    }
+};
+
+static bool selected(const char* name) {
+    return !onlyBench || strstr(name, onlyBench);
+}
+
+static uint32_t iterations(uint32_t full) {
+    return quick ? max(full / 50, (uint32_t)1) : full;
+}
+
+// ===== Screens =====
+// Layouts mirror the example firmware so the numbers match what the
+// CYD actually draws.
+static void noopButton(const char*) {}
+static void noopSlider(int) {}
+
+static void logRow(int row, int column, char* out, size_t len) {
+    snprintf(out, len, column ? "%d.%02d kg" : "#%04d", row, row % 100);
+}
+
+static LabelHandle filterLabels[6];
+static SliderHandle filterSliders[4];
+
+static void buildMenuScreen() {
+    int padding = 4;
+    int buttonWidth = (SCREEN_WIDTH - 3 * padding) / 2;
+    int buttonHeight = (SCREEN_HEIGHT - 3 * padding) / 2;
+
+    addButton(padding, padding, buttonWidth, buttonHeight, "BACK", noopButton, 4);
+    addButton(2 * padding + buttonWidth, padding, buttonWidth, buttonHeight, "FILTERS", noopButton, 4);
+    addButton(padding, 2 * padding + buttonHeight, buttonWidth, buttonHeight, "CALIBRATION", noopButton, 4);
+    addButton(2 * padding + buttonWidth, 2 * padding + buttonHeight, buttonWidth, buttonHeight, "OTHER", noopButton, 4);
+    drawAllButtons();
+}
+
+static void buildFilterScreen() {
+    addButton(SCREEN_WIDTH-(SCREEN_WIDTH/5)-20, 0, SCREEN_WIDTH/5+20, 50, ">", noopButton, 4, TFT_GREEN, TFT_BLACK);
+    addButton(0, 0, SCREEN_WIDTH/5 + 20, 50, "X", noopButton, 4, TFT_RED, TFT_BLACK);
+    drawAllButtons();
+
+    filterSliders[0] = addSlider(5, 50,  SCREEN_WIDTH-76, 50, config.meanSlider,      noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    filterSliders[1] = addSlider(5, 100, SCREEN_WIDTH-76, 50, config.filterSlider,    noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    filterSliders[2] = addSlider(5, 150, SCREEN_WIDTH-76, 50, config.vibrationSlider, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    filterSliders[3] = addSlider(5, 200, SCREEN_WIDTH-76, 50, config.lockingSlider,   noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    drawAllSliders();
+
+    drawTriangleWithBorder(95, 30, 18, 18, 3, TFT_BLACK, TFT_YELLOW);
+    for (int row = 0; row < 4; row++) {
+        drawTriangleWithBorder(SCREEN_WIDTH-66, 60 + row * 50, 16, 16, 3, TFT_BLACK, TFT_YELLOW);
+    }
+
+    filterLabels[0] = addLabel(120,  0, "0000", 4);
+    filterLabels[1] = addLabel(120, 28, "0000", 4);
+    for (int row = 0; row < 4; row++) {
+        filterLabels[2 + row] = addLabel(SCREEN_WIDTH-52, 54 + row * 50, "0000", 2);
+    }
+
+    drawText(SCREEN_WIDTH-46,  72, "MEAN"  , 2, TFT_GREEN);
+    drawText(SCREEN_WIDTH-46, 122, "FILTER", 2, TFT_GREEN);
+    drawText(SCREEN_WIDTH-46, 172, "DAMP"  , 2, TFT_GREEN);
+    drawText(SCREEN_WIDTH-46, 222, "LOCK"  , 2, TFT_GREEN);
+}
+
+// ===== Scenarios =====
+// One op = one updateLabel() with text that differs from the last.
+static void benchLabelStorm() {
+    clearScreen();
+    buildFilterScreen();
+
+    uint32_t n = iterations(20000);
+    char text[16];
+    BenchRun run("label_update_storm");
+    for (uint32_t i = 0; i < n; i++) {
+        snprintf(text, sizeof(text), "%lu", (unsigned long)(i % 10000));
+        updateLabel(filterLabels[i % 6], text);
+    }
+    run.finish(n);
+}
+
+// One op = one loop pass while a finger drags a FILTERS slider thumb
+// 4 px along its track; every slider is swept end to end and released.
+// slider_full_redraw repaints the whole slider per step for comparison.
+static void benchSliderDrag() {
+    clearScreen();
+    buildFilterScreen();
+
+    uint32_t sweeps = iterations(100);
+    uint64_t ops = 0;
+    {
+        BenchRun run("slider_drag");
+        for (uint32_t s = 0; s < sweeps; s++) {
+            const UIRect &r = currentDisplay().sliders.rect[s % 4];
+            int y = r.y + r.h / 2;
+            for (int x = r.x; x < r.x + r.w; x += 4) {
+                touchAt(x, y);
+                loopOnce();
+                ops++;
+            }
+            touchscreen.hostRelease();
+            loopOnce();
+            ops++;
+        }
+        run.finish(ops);
+    }
+    {
+        BenchRun run("slider_full_redraw");
+        for (uint64_t i = 0; i < ops; i++) drawSlider(filterSliders[i % 4]);
+        run.finish(ops);
+    }
+}
+
+// One op = one press or one release of a MENU button: the loop pass
+// that repaints it in its pressed or normal colour.
+static void benchButtonPress() {
+    clearScreen();
+    buildMenuScreen();
+
+    uint32_t n = iterations(10000);
+    int padding = 10;
+    int buttonWidth = (SCREEN_WIDTH - 3 * padding) / 2;
+    int buttonHeight = (SCREEN_HEIGHT - 3 * padding) / 2;
+    BenchRun run("button_press");
+    for (uint32_t i = 0; i < n; i++) {
+        int col = i & 1, row = (i >> 1) & 1;
+        touchAt(padding + col * (padding + buttonWidth) + buttonWidth / 2, padding + row * (padding + buttonHeight) + buttonHeight / 2);
+        loopOnce();
+        touchscreen.hostRelease();
+        loopOnce();
+    }
+    run.finish(2 * n);
+}
+
+// One op = clearScreen() plus a full rebuild, alternating between the
+// MENU and FILTERS screens.
+static void benchScreenSwitch() {
+    uint32_t n = iterations(1000);
+    BenchRun run("screen_switch");
+    for (uint32_t i = 0; i < n; i++) {
+        clearScreen();
+        if (i & 1) {
+            buildFilterScreen();
+        } else {
+            buildMenuScreen();
+        }
+    }
+    run.finish(n);
+    clearScreen();
+}
+
+// The same switch as strips a frame apart; draws as many pixels but
+// opens more windows, since every strip redraws what overlaps it.
+static void menuScreen()   { clearScreen(); buildMenuScreen(); }
+static void filterScreen() { clearScreen(); buildFilterScreen(); }
+
+static void benchScreenTransition() {
+    uint32_t n = iterations(100);
+    BenchRun run("screen_transition_slide");
+    for (uint32_t i = 0; i < n; i++) {
+        showScreen((i & 1) ? filterScreen : menuScreen, (i & 1) ? TRANSITION_SLIDE_LEFT : TRANSITION_SLIDE_RIGHT);
+    }
+    run.finish(n);
+    clearScreen();
+}
+
+static void benchCircles() {
+    uint32_t n = iterations(20000);
+    {
+        BenchRun run("circle_with_border");
+        for (uint32_t i = 0; i < n; i++) {
+            drawCircleWithBorder(SCREEN_WIDTH-50, 4, 20, 2, (i & 1) ? TFT_RED : TFT_BLACK);
+        }
+        run.finish(n);
+    }
+    {
+        BenchRun run("quarter_circle_with_border");
+        for (uint32_t i = 0; i < n; i++) {
+            drawQuarterCircleWithBorder(SCREEN_WIDTH-50, 55, 38, 2, (i & 1) ? TFT_RED : TFT_BLACK);
+        }
+        run.finish(n);
+    }
+}
+
+// One op = scrollList() by 3 px through a 5000 row log. Landscape
+// redraws every visible row; portrait uses the panel's scroll registers
+// and draws only the 3 newly exposed lines.
+static void benchListScroll(const char* name, uint8_t rotation, int x, int y, int w, int h) {
+    static const uint8_t columns[] = { 80, 120 };
+    clearScreen();
+    setDisplayRotation(rotation);
+    ListHandle list = addList(x, y, w, h, 5000, logRow);
+    setListColumns(list, columns, 2);
+
+    uint32_t n = iterations(4000);
+    BenchRun run(name);
+    for (uint32_t i = 0; i < n; i++) {
+        scrollList(list, 3);
+    }
+    run.finish(n);
+    clearScreen();
+    setDisplayRotation(SCREEN_ROTATION);
+}
+
+// One op = one setGauge() / setProgress() stepping the value by 1,
+// swept 0..100..0, next to one full redraw for comparison.
+static void benchGauge() {
+    clearScreen();
+    GaugeHandle gauge = addGauge(160, 120, 80, 14, 0);
+    ProgressHandle bar = addProgressBar(10, 220, 300, 16, 0);
+    drawAllGauges();
+    drawAllProgressBars();
+
+    uint32_t n = iterations(20000);
+    {
+        BenchRun run("gauge_step");
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t k = i % 200;
+            setGauge(gauge, k <= 100 ? k : 200 - k);
+        }
+        run.finish(n);
+    }
+    {
+        BenchRun run("gauge_full_redraw");
+        for (uint32_t i = 0; i < n / 10; i++) drawGauge(gauge);
+        run.finish(n / 10);
+    }
+    {
+        BenchRun run("progress_step");
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t k = i % 200;
+            setProgress(bar, k <= 100 ? k : 200 - k);
+        }
+        run.finish(n);
+    }
+    clearScreen();
+}
+
+// One op = one flash image decoded straight to the panel: a 32x32
+// palette icon and a 64x48 RGB565 picture.
+static void benchImages() {
+    clearScreen();
+    uint32_t n = iterations(20000);
+    {
+        BenchRun run("image_draw_icon");
+        for (uint32_t i = 0; i < n; i++) drawImage(10, 10, &status_ok);
+        run.finish(n);
+    }
+    {
+        BenchRun run("image_draw_rle565");
+        for (uint32_t i = 0; i < n; i++) drawImage(60, 10, &sunset);
+        run.finish(n);
+    }
+    clearScreen();
+}
+
+// One op = one opaque weight readout: TFT_eSPI Font 4 with a background
+// colour, then the 4 bpp subset font, which streams its line box
+// through a single address window. The _bus runs repeat both on a
+// 40 MHz panel bus, where the cost is pixels and windows, not host CPU.
+static void benchFontReadouts(const char* stockName, const char* subsetName, uint32_t n) {
+    char text[16];
+    {
+        BenchRun run(stockName);
+        tft.setTextFont(4);
+        tft.setTextDatum(TL_DATUM);
+        tft.setTextColor(TFT_WHITE, BACKGROUND_COLOR);
+        for (uint32_t i = 0; i < n; i++) {
+            snprintf(text, sizeof(text), "%.2f kg", (i % 2000) / 100.0f);
+            tft.drawString(text, 10, 10);
+        }
+        run.finish(n);
+    }
+    {
+        BenchRun run(subsetName);
+        for (uint32_t i = 0; i < n; i++) {
+            snprintf(text, sizeof(text), "%.2f kg", (i % 2000) / 100.0f);
+            drawFontText(10, 50, text, &font_digits28);
+        }
+        run.finish(n);
+    }
+}
+
+static void benchFontText() {
+    clearScreen();
+    uint32_t n = iterations(20000);
+    benchFontReadouts("text_stock_f4", "text_font_subset", n);
+
+    hostPanelSpiHz = 40000000;
+    hostBusTimeReset();
+    benchFontReadouts("text_stock_f4_bus", "text_font_subset_bus", n);
+    hostPanelSpiHz = 0;
+    clearScreen();
+}
+
+// ===== Filter chain =====
+static std::vector<uint8_t> loadTrace(const char* path) {
+    std::vector<uint8_t> bytes;
+    FILE* f = fopen(path, "rb");
+    if (!f) return bytes;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        bytes.insert(bytes.end(), buf, buf + n);
+    }
+    fclose(f);
+    return bytes;
+}
+
+// One op = one reading parsed out of the HC-12 byte log the way
+// checkHC12() does and pushed through every filter stage.
+static void benchFilterChain(const std::vector<uint8_t> &trace) {
+    if (trace.empty()) return;
+
+    uint32_t passes = iterations(200);
+    uint64_t ops = 0;
+    volatile float sink = 0;
+    char hc_buf[20];
+    size_t bindex = 0;
+    BenchRun run("filter_chain");
+    for (uint32_t p = 0; p < passes; p++) {
+        for (size_t n = 0; n < trace.size(); n++) {
+            char c = trace[n];
+            if (c == '\n') {
+                hc_buf[bindex] = '\0';
+                if (bindex > 0) {
+                    FilterStep step;
+                    hostAdvanceMicros(LOOP_US);
+                    sink = runFilterChain(atol(hc_buf), step);
+                    ops++;
+                }
+                bindex = 0;
+            } else if (bindex < sizeof(hc_buf) - 1) {
+                hc_buf[bindex++] = c;
+            } else {
+                bindex = 0;
+            }
+        }
+    }
+    run.finish(ops);
+    (void)sink;
+}
+
+// One op = one reading through the filter chain with the raw and
+// filtered values pushed onto a 300x150 strip chart, as a trend screen
+// would. A full redraw per sample would be 45000 pixels.
+static void benchTrendChart(const std::vector<uint8_t> &trace) {
+    if (trace.empty()) return;
+    clearScreen();
+    ChartHandle chart = addChart(10, 60, 300, 150, 2, config.zero_raw - 2000.0f, config.fso_raw + 2000.0f);
+    drawAllCharts();
+
+    uint32_t passes = iterations(20);
+    uint64_t ops = 0;
+    char hc_buf[20];
+    size_t bindex = 0;
+    BenchRun run("trend_chart_push");
+    for (uint32_t p = 0; p < passes; p++) {
+        for (size_t n = 0; n < trace.size(); n++) {
+            char c = trace[n];
+            if (c == '\n') {
+                hc_buf[bindex] = '\0';
+                if (bindex > 0) {
+                    FilterStep step;
+                    long raw = atol(hc_buf);
+                    runFilterChain(raw, step);
+                    float values[2] = { (float)raw, step.out[STAGE_LOCK] };
+                    chartPush(chart, values);
+                    ops++;
+                }
+                bindex = 0;
+            } else if (bindex < sizeof(hc_buf) - 1) {
+                hc_buf[bindex++] = c;
+            } else {
+                bindex = 0;
+            }
+        }
+    }
+    run.finish(ops);
+    clearScreen();
+}
+
+// ===== Output =====
+static void printTable() {
+    printf("%-28s %10s %12s %12s %10s %14s %10s\n", "benchmark", "ops", "ns/op", "pixels/op", "windows/op", "sprite px/op", "bus us/op");
+    for (const BenchResult &r : results) {
+        printf("%-28s %10llu %12.1f %12.1f %10.2f %14.1f %10.2f\n", r.name.c_str(), (unsigned long long)r.ops,
+               r.nsPerOp, r.pixelsPerOp, r.windowsPerOp, r.spritePixelsPerOp, r.busUsPerOp);
+    }
+}
+
+static bool writeJson(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n  \"quick\": %s,\n  \"benchmarks\": [\n", quick ? "true" : "false");
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult &r = results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"ops\": %llu, \"ns_per_op\": %.2f, \"pixels_per_op\": %.2f, "
+                   "\"bytes_per_op\": %.2f, \"windows_per_op\": %.3f, \"sprite_pixels_per_op\": %.2f, "
+                   "\"bus_us_per_op\": %.2f}%s\n",
+                r.name.c_str(), (unsigned long long)r.ops, r.nsPerOp, r.pixelsPerOp,
+                r.bytesPerOp, r.windowsPerOp, r.spritePixelsPerOp, r.busUsPerOp, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* jsonPath  = nullptr;
+    const char* tracePath = BENCH_DEFAULT_TRACE;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--quick") {
+            quick = true;
+        } else if (arg == "--json" && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (arg == "--trace" && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (arg == "--filter" && i + 1 < argc) {
+            onlyBench = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--quick] [--json out.json] [--trace hc12.log] [--filter name]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    microUIInit();
+
+    if (selected("label_update_storm"))     benchLabelStorm();
+    if (selected("slider_drag") || selected("slider_full_redraw")) benchSliderDrag();
+    if (selected("button_press"))           benchButtonPress();
+    if (selected("screen_switch"))          benchScreenSwitch();
+    if (selected("screen_transition"))      benchScreenTransition();
+    if (selected("circle"))                 benchCircles();
+    if (selected("gauge") || selected("progress")) benchGauge();
+    if (selected("image_draw"))             benchImages();
+    if (selected("text_stock_f4") || selected("text_font_subset")) benchFontText();
+    if (selected("list_scroll_redraw"))     benchListScroll("list_scroll_redraw", SCREEN_ROTATION, 0, 20, SCREEN_WIDTH, 200);
+    if (selected("list_scroll_hardware"))   benchListScroll("list_scroll_hardware", 0, 0, 20, TFT_WIDTH, 280);
+    if (selected("filter_chain") || selected("trend_chart_push")) {
+        std::vector<uint8_t> trace = loadTrace(tracePath);
+        if (trace.empty()) {
+            fprintf(stderr, "cannot read trace %s\n", tracePath);
+            return 1;
+        }
+        if (selected("filter_chain"))       benchFilterChain(trace);
+        if (selected("trend_chart_push"))   benchTrendChart(trace);
+    }
+
+    printTable();
+    printf("widget arena peak: %u of %u bytes\n", (unsigned)microUIArenaPeak(), (unsigned)MICRO_UI_ARENA_SIZE);
+    if (jsonPath && !writeJson(jsonPath)) {
+        fprintf(stderr, "cannot write %s\n", jsonPath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,667 @@
+// Golden-image rendering regression harness.
+//
+// Every case clears the stub panel to a sentinel colour, draws one
+// widget or primitive and compares the whole screen with a golden
+// RGB565 image in golden/. Goldens store only the bounding box of the
+// pixels that changed; everything outside it must still hold the
+// sentinel, so stray writes are caught too.
+//
+// Each case also records the pixels and address windows it sent to the
+// panel. The manifest keeps the accepted counts: a case that sends more
+// than before fails, one that sends less passes and is reported so the
+// manifest can be tightened with --update. Host timing is reported but
+// never gated since it depends on the machine.
+//
+// Text is drawn with the stub fonts in host/, so label and button
+// goldens pin micro_ui's layout and sprite handling, not TFT_eSPI's
+// glyph shapes.
+//
+// Built with MICRO_UI_FRAMEBUFFER the harness flushes the frame after
+// each draw and reads its goldens from golden/framebuffer/: a manifest
+// of its own, since traffic differs, and images only for the cases whose
+// output differs from sprite mode (no 8-bit quantisation, for one). The
+// others are read from golden/, and --update only writes the images
+// that differ.
+//
+//   micro_ui_golden [--update] [--repeat n] [--filter name] [--json out.json] [--diff-dir dir]
+#include "bench_common.h"
+#include "assets/bench_images.h"
+#include "assets/font_digits14.h"
+#include "assets/font_digits20.h"
+#include "assets/font_digits28.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#define SENTINEL_COLOR  0x18E3      // Never drawn by any case
+#define GOLDEN_MAGIC    0x35363547UL // "G565"
+
+struct GoldenCase {
+    std::string                 name;
+    std::function<void()>       setup;  // Untimed; builds widgets
+    std::function<void(int)>    draw;   // Timed; pass 0 produces the golden
+};
+
+struct GoldenImage {
+    int16_t x, y, w, h;
+    std::vector<uint16_t> pixels;
+};
+
+struct Budget {
+    uint64_t pixels;
+    uint64_t windows;
+};
+
+static std::vector<GoldenCase> cases;
+
+// ===== Case sweep =====
+static void noopButton(const char*) {}
+static void noopSlider(int) {}
+static void noopList(int) {}
+
+static void switchScreenButton(const char*) {
+    clearScreen();
+    addButton(170, 130, 140, 100, "BACK", switchScreenButton, 2, TFT_DARKGREEN);
+    drawAllButtons();
+}
+
+// One callback for a row of buttons: the id picks the digit shown.
+static void keypadButton(const UIEvent &event, void *context) {
+    char text[8];
+    snprintf(text, sizeof(text), "%d", event.id);
+    updateLabel(*(LabelHandle*)context, text);
+}
+
+// Screens for the transitions: every kind of drawing a screen does,
+// including streamed images and font text, must stay inside its strip.
+static void transitionFrom() {
+    clearScreen();
+    addButton(5, 5, 150, 110, "BACK", noopButton, 4);
+    addButton(165, 125, 150, 110, "OTHER", noopButton, 4, TFT_DARKGREY);
+    drawAllButtons();
+}
+
+static void transitionTo() {
+    clearScreen();
+    addButton(0, 0, 84, 50, "X", noopButton, 4, TFT_RED, TFT_BLACK);
+    addSlider(5, 60, 244, 50, 40, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    addLabel(120, 10, "12.50", 4);
+    addImage(250, 120, &sunset);
+    drawAllButtons();
+    drawAllSliders();
+    drawAllImages();
+    drawFontText(10, 130, "-12.50 kg", &font_digits28);
+    drawCircleWithBorder(200, 200, 20, 2, TFT_RED);
+}
+
+// Load cell style step with ringing: noisy raw plus a smoothed copy.
+static void pushSettle(ChartHandle chart, int samples, int offset) {
+    uint32_t seed = 12345;
+    float smooth = 0;
+    for (int n = 0; n < samples; n++) {
+        float t = (n + offset) * 0.08f;
+        float clean = 1.0f - expf(-t * 0.5f) * cosf(t * 2.0f);
+        seed = seed * 1103515245 + 12345;
+        float values[2] = { clean + ((int)(seed >> 16) % 200 - 100) * 0.002f, 0 };
+        smooth += (values[0] - smooth) * 0.2f;
+        values[1] = smooth;
+        chartPush(chart, values);
+    }
+}
+
+// Weighing log rows: index, weight, status.
+static void logRow(int row, int column, char* out, size_t len) {
+    switch (column) {
+        case 0:  snprintf(out, len, "#%04d", row); break;
+        case 1:  snprintf(out, len, "%d.%02d kg", (row * 37) % 100, (row * 13) % 100); break;
+        default: snprintf(out, len, "%s", (row % 3) ? "OK" : "UNSTABLE"); break;
+    }
+}
+
+static const char* quarterName(Quarter q) {
+    switch (q) {
+        case TOP_LEFT:      return "tl";
+        case TOP_RIGHT:     return "tr";
+        case BOTTOM_LEFT:   return "bl";
+        case BOTTOM_RIGHT:  return "br";
+    }
+    return "?";
+}
+
+static std::string fmt(const char* f, ...) __attribute__((format(printf, 1, 2)));
+static std::string fmt(const char* f, ...) {
+    char buf[96];
+    va_list args;
+    va_start(args, f);
+    vsnprintf(buf, sizeof(buf), f, args);
+    va_end(args);
+    return buf;
+}
+
+static void addCases() {
+    static const int radii[] = { 5, 12, 20, 33 };
+    static const int borders[] = { 0, 1, 2, 4 };
+    for (int r : radii) {
+        for (int b : borders) {
+            cases.push_back({ fmt("circle_r%d_b%d_blue", r, b), nullptr,
+                [=](int) { drawCircleWithBorder(40, 40, r, b, TFT_BLUE, TFT_WHITE); } });
+            cases.push_back({ fmt("circle_r%d_b%d_red", r, b), nullptr,
+                [=](int) { drawCircleWithBorder(40, 40, r, b, TFT_RED, TFT_YELLOW); } });
+        }
+    }
+
+    static const int quarterRadii[] = { 10, 24, 38 };
+    static const int quarterBorders[] = { 0, 2, 4 };
+    static const Quarter quarters[] = { TOP_LEFT, TOP_RIGHT, BOTTOM_LEFT, BOTTOM_RIGHT };
+    for (int r : quarterRadii) {
+        for (int b : quarterBorders) {
+            for (Quarter q : quarters) {
+                cases.push_back({ fmt("quarter_r%d_b%d_%s", r, b, quarterName(q)), nullptr,
+                    [=](int) { drawQuarterCircleWithBorder(40, 40, r, b, TFT_BLUE, TFT_WHITE, q); } });
+            }
+        }
+    }
+
+    static const int triangleSizes[] = { 10, 16, 18, 40 };
+    static const int triangleBorders[] = { 0, 1, 3 };
+    for (int s : triangleSizes) {
+        for (int b : triangleBorders) {
+            cases.push_back({ fmt("triangle_s%d_b%d", s, b), nullptr,
+                [=](int) { drawTriangleWithBorder(20, 20, s, s, b, TFT_BLACK, TFT_YELLOW); } });
+        }
+    }
+
+    // Labels are created untimed, then updated; odd passes flip the text
+    // back so every timed pass really redraws.
+    static const uint8_t fonts[] = { 1, 2, 4, 6, 7, 8 };
+    static LabelHandle label;
+    for (uint8_t font : fonts) {
+        cases.push_back({ fmt("label_f%d_white", font),
+            [=]() { label = addLabel(10, 10, "0000", font); },
+            [=](int pass) { updateLabel(label, (pass & 1) ? "0000" : "-12.5"); } });
+        cases.push_back({ fmt("label_f%d_yellow_on_blue", font),
+            [=]() { label = addLabel(10, 10, "0000", font, TFT_YELLOW, TFT_BLUE); },
+            [=](int pass) { updateLabel(label, (pass & 1) ? "0000" : "-12.5"); } });
+    }
+    cases.push_back({ "label_recolor",
+        []() { label = addLabel(10, 10, "88.8", 4); },
+        [](int pass) { updateLabel(label, "88.8", (pass & 1) ? TFT_WHITE : TFT_RED); } });
+
+    static const int sliderValues[] = { 0, 37, 100 };
+    static const int sliderWidths[] = { 244, 120 };
+    for (int w : sliderWidths) {
+        for (int v : sliderValues) {
+            cases.push_back({ fmt("slider_w%d_v%d", w, v),
+                [=]() { addSlider(5, 50, w, 50, v, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK); },
+                [](int) { drawAllSliders(); } });
+        }
+    }
+    // Dragged by touch: held shows the pressed thumb, released the normal one.
+    // A drag only repaints the thumb, so the slider is drawn first as any
+    // screen does.
+    cases.push_back({ "slider_drag_held",
+        []() { addSlider(5, 50, 244, 50, 0, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK); drawAllSliders(); },
+        [](int pass) { touchAt((pass & 1) ? 40 : 150, 75); loopOnce(); } });
+    cases.push_back({ "slider_drag_released",
+        []() { addSlider(5, 50, 244, 50, 0, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK); drawAllSliders(); },
+        [](int pass) { touchAt((pass & 1) ? 40 : 150, 75); loopOnce(); touchscreen.hostRelease(); loopOnce(); } });
+    // Short moves repaint the old and new thumb as one strip.
+    cases.push_back({ "slider_drag_nudge",
+        []() { addSlider(5, 50, 244, 50, 0, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK); drawAllSliders(); touchAt(110, 75); loopOnce(); },
+        [](int pass) { touchAt((pass & 1) ? 110 : 118, 75); loopOnce(); } });
+
+    static const uint8_t buttonFonts[] = { 2, 4 };
+    for (uint8_t font : buttonFonts) {
+        cases.push_back({ fmt("button_f%d", font),
+            [=]() { addButton(10, 10, 150, 60, "FILTERS", noopButton, font); },
+            [](int) { drawAllButtons(); } });
+        cases.push_back({ fmt("button_f%d_pressed", font),
+            [=]() { addButton(10, 10, 150, 60, "FILTERS", noopButton, font); drawAllButtons(); },
+            [](int) { touchAt(80, 40); loopOnce(); touchscreen.hostRelease(); loopOnce(); touchAt(80, 40); loopOnce(); } });
+    }
+    // The callback switches screens from the event queue, after the
+    // release has been drawn; the old button must not come back.
+    cases.push_back({ "button_callback_switch",
+        []() { addButton(10, 10, 150, 60, "MENU", switchScreenButton, 4); drawAllButtons(); },
+        [](int) { touchAt(80, 40); loopOnce(); hostAdvanceMicros(50000); touchscreen.hostRelease(); loopOnce(); } });
+    // A second display has widgets of its own: clearing and building it
+    // must neither draw on the primary panel nor remove its button.
+    static TFT_eSPI remotePanel(128, 160);
+    static MicroDisplay remote(remotePanel, 160, 128, 1);
+    cases.push_back({ "display_remote_separate",
+        []() { microUIAddDisplay(remote); addButton(10, 10, 150, 60, "MENU", noopButton, 4); },
+        [](int pass) {
+            useDisplay(remote);
+            clearScreen();
+            addLabel(5, 5, (pass & 1) ? "1.25 kg" : "0.00 kg", 4);
+            useDisplay(primaryDisplay);
+            drawAllButtons();
+        } });
+    // Three buttons share keypadButton(); each tap shows its own id.
+    static LabelHandle keypadLabel;
+    cases.push_back({ "button_id_keypad",
+        []() {
+            keypadLabel = addLabel(10, 100, "0", 4);
+            for (int n = 0; n < 3; n++) addButton(10 + n * 100, 10, 90, 60, "KEY", 7 + n, keypadButton, &keypadLabel, 4);
+            drawAllButtons();
+        },
+        [](int pass) { touchAt(55 + (pass % 3) * 100, 40); loopOnce(); hostAdvanceMicros(50000); touchscreen.hostRelease(); loopOnce(); } });
+    // Too large for a face sprite: press feedback is drawn on the panel.
+    cases.push_back({ "button_direct_pressed",
+        []() { addButton(10, 10, 200, 110, "FILTERS", noopButton, 4); drawAllButtons(); },
+        [](int) { touchAt(110, 65); loopOnce(); touchscreen.hostRelease(); loopOnce(); touchAt(110, 65); loopOnce(); } });
+    // Press feedback reuses the text layout; a new label must replace it.
+    static ButtonHandle relabelled;
+    cases.push_back({ "button_relabel_pressed",
+        []() { relabelled = addButton(10, 10, 150, 60, "FILTERS", noopButton, 4); drawAllButtons(); },
+        [](int pass) { updateButton(relabelled, (pass & 1) ? "OK" : "CANCEL"); touchAt(80, 40); loopOnce(); } });
+
+    // Transitions must end on exactly the screen built directly.
+    cases.push_back({ "transition_target", nullptr, [](int) { transitionTo(); } });
+    cases.push_back({ "transition_slide_left", transitionFrom, [](int) { showScreen(transitionTo, TRANSITION_SLIDE_LEFT); } });
+    cases.push_back({ "transition_slide_right", transitionFrom, [](int) { showScreen(transitionTo, TRANSITION_SLIDE_RIGHT); } });
+    cases.push_back({ "transition_wipe_down", transitionFrom, [](int) { showScreen(transitionTo, TRANSITION_WIPE_DOWN); } });
+
+    // Lists: 1000 virtual rows, landscape, so every scroll is a redraw.
+    static const uint8_t logColumns[] = { 60, 90, 70 };
+    static ListHandle list;
+    cases.push_back({ "list_rows",
+        []() { list = addList(10, 20, 220, 150, 1000, logRow, noopList); },
+        [](int) { drawAllLists(); } });
+    cases.push_back({ "list_table",
+        []() { list = addList(10, 20, 220, 150, 1000, logRow, noopList); setListColumns(list, logColumns, 3); },
+        [](int) { drawAllLists(); } });
+    cases.push_back({ "list_drag_scroll",
+        []() { list = addList(10, 20, 220, 150, 1000, logRow, noopList); drawAllLists(); },
+        [](int pass) {
+            int to = (pass & 1) ? 137 : 63;
+            touchAt(100, 100); loopOnce(); touchAt(100, to); loopOnce(); touchscreen.hostRelease(); loopOnce();
+        } });
+    cases.push_back({ "list_tap_select",
+        []() { list = addList(10, 20, 220, 150, 1000, logRow, noopList); drawAllLists(); },
+        [](int pass) {
+            touchAt(100, (pass & 1) ? 30 : 80);
+            for (int i = 0; i < 6; i++) loopOnce();     // Held past the debounce
+            touchscreen.hostRelease(); loopOnce();
+        } });
+
+    // Charts: history is drawn untimed, the timed part pushes samples.
+    static ChartHandle chart;
+    cases.push_back({ "chart_sweep",
+        []() { chart = addChart(10, 10, 200, 100, 2, -0.5f, 2.0f); drawAllCharts(); },
+        [](int pass) { pushSettle(chart, 150, pass * 150); } });
+    cases.push_back({ "chart_decimated",
+        []() { chart = addChart(10, 10, 200, 100, 2, -0.5f, 2.0f, 8); drawAllCharts(); },
+        [](int pass) { pushSettle(chart, 800, pass * 800); } });
+    cases.push_back({ "chart_wrap",
+        []() { chart = addChart(10, 10, 60, 80, 2, -0.5f, 2.0f, 1, TFT_NAVY, TFT_BLUE); drawAllCharts(); },
+        [](int pass) { pushSettle(chart, 100, pass * 100); } });
+    // The removed chart's block is too small for the wider one, which must
+    // not write its history over the progress bar added in between.
+    cases.push_back({ "chart_remove_add_wider",
+        []() {
+            ChartHandle narrow = addChart(10, 10, 20, 50, 1, -0.5f, 2.0f);
+            addProgressBar(10, 200, 300, 24, 37);
+            removeChart(narrow);
+            chart = addChart(10, 10, 300, 100, 2, -0.5f, 2.0f);
+            drawAllCharts();
+        },
+        [](int pass) { pushSettle(chart, 300, pass * 300); drawAllProgressBars(); } });
+
+    // Progress bars and gauges: full draws, then delta updates that must
+    // land on the same pixels a full draw of the new value would.
+    static ProgressHandle progress;
+    static const int progressValues[] = { 0, 37, 100 };
+    for (int v : progressValues) {
+        cases.push_back({ fmt("progress_v%d", v),
+            [=]() { progress = addProgressBar(10, 10, 200, 24, v); },
+            [](int) { drawAllProgressBars(); } });
+    }
+    cases.push_back({ "progress_delta",
+        []() { progress = addProgressBar(10, 10, 200, 24, 20); drawAllProgressBars(); },
+        [](int pass) { setProgress(progress, (pass & 1) ? 20 : 65); } });
+
+    static GaugeHandle gauge;
+    static const int gaugeValues[] = { 0, 50, 100 };
+    for (int v : gaugeValues) {
+        cases.push_back({ fmt("gauge_r40_t8_v%d", v),
+            [=]() { gauge = addGauge(60, 60, 40, 8, v); },
+            [](int) { drawAllGauges(); } });
+    }
+    cases.push_back({ "gauge_half_red",
+        []() { gauge = addGauge(60, 60, 33, 12, 70, TFT_RED, TFT_NAVY, -90, 90); },
+        [](int) { drawAllGauges(); } });
+    cases.push_back({ "gauge_delta_up",
+        []() { gauge = addGauge(60, 60, 40, 8, 20); drawAllGauges(); },
+        [](int pass) { setGauge(gauge, (pass & 1) ? 20 : 63); } });
+    cases.push_back({ "gauge_delta_down",
+        []() { gauge = addGauge(60, 60, 40, 8, 90); drawAllGauges(); },
+        [](int pass) { setGauge(gauge, (pass & 1) ? 90 : 41); } });
+    cases.push_back({ "arc_pie", nullptr, [](int) { fillArc(50, 50, 30, 31, 30, 300, TFT_ORANGE); } });
+
+    // Images from bench/assets, converted by tools/micro_ui_image.py.
+    static ImageHandle image;
+    cases.push_back({ "image_indexed",
+        []() { addImage(10, 10, &status_ok); },
+        [](int) { drawAllImages(); } });
+    cases.push_back({ "image_rle565",
+        []() { addImage(10, 10, &sunset); },
+        [](int) { drawAllImages(); } });
+    cases.push_back({ "image_clipped", nullptr,
+        [](int) { drawImage(-20, -10, &sunset); drawImage(SCREEN_WIDTH - 30, SCREEN_HEIGHT - 20, &sunset); } });
+    cases.push_back({ "image_swap_smaller",
+        []() { image = addImage(10, 10, &sunset); drawAllImages(); },
+        [](int pass) { setImage(image, (pass & 1) ? &sunset : &status_ok); } });
+
+    cases.push_back({ "text_f2_green", nullptr, [](int) { drawText(10, 10, "FILTER", 2, TFT_GREEN); } });
+    cases.push_back({ "text_f4_white", nullptr, [](int) { drawText(10, 10, "0.00 kg", 4); } });
+    cases.push_back({ "text_centered_f4", nullptr, [](int) { drawCenteredText("SAVED"); } });
+
+    // Subset fonts from bench/assets/bench_digits.ttf at each bit depth.
+    cases.push_back({ "font_4bpp_weight", nullptr, [](int) { drawFontText(10, 10, "-12.50 kg", &font_digits28); } });
+    cases.push_back({ "font_2bpp_digits", nullptr, [](int) { drawFontText(10, 10, "0123456789", &font_digits20, TFT_GREEN); } });
+    cases.push_back({ "font_1bpp_on_navy", nullptr, [](int) { drawFontText(10, 10, "AV 1.1 kg", &font_digits14, TFT_YELLOW, TFT_NAVY); } });
+    cases.push_back({ "font_kerned_overlap", nullptr, [](int) { drawFontText(10, 10, "AVAV 11", &font_digits28, TFT_WHITE, TFT_NAVY); } });
+    cases.push_back({ "font_clipped", nullptr,
+        [](int) { drawFontText(-9, -7, "8.8", &font_digits28, TFT_ORANGE); drawFontText(SCREEN_WIDTH - 30, SCREEN_HEIGHT - 15, "gAV", &font_digits28); } });
+}
+
+// ===== Golden files =====
+// Header (magic, x, y, w, h) followed by (count, colour) runs, all
+// little-endian as written by the host.
+static std::string goldenPath(const std::string &dir, const std::string &name) {
+    return dir + "/" + name + ".565";
+}
+
+static bool readGolden(const std::string &path, GoldenImage &img) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    uint32_t magic = 0;
+    int16_t  rect[4];
+    bool ok = fread(&magic, sizeof(magic), 1, f) == 1 && magic == GOLDEN_MAGIC
+        && fread(rect, sizeof(rect), 1, f) == 1 && rect[2] >= 0 && rect[3] >= 0;
+    if (ok) {
+        img.x = rect[0]; img.y = rect[1]; img.w = rect[2]; img.h = rect[3];
+        img.pixels.clear();
+        size_t total = (size_t)img.w * img.h;
+        uint16_t run[2];
+        while (img.pixels.size() < total && fread(run, sizeof(run), 1, f) == 1) {
+            img.pixels.insert(img.pixels.end(), run[0], run[1]);
+        }
+        ok = img.pixels.size() == total;
+    }
+    fclose(f);
+    return ok;
+}
+
+static bool writeGolden(const std::string &path, const GoldenImage &img) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    uint32_t magic = GOLDEN_MAGIC;
+    int16_t  rect[4] = { img.x, img.y, img.w, img.h };
+    fwrite(&magic, sizeof(magic), 1, f);
+    fwrite(rect, sizeof(rect), 1, f);
+    for (size_t i = 0; i < img.pixels.size();) {
+        uint16_t run[2] = { 1, img.pixels[i] };
+        while (i + run[0] < img.pixels.size() && img.pixels[i + run[0]] == run[1] && run[0] < 0xFFFF) run[0]++;
+        fwrite(run, sizeof(run), 1, f);
+        i += run[0];
+    }
+    return fclose(f) == 0;
+}
+
+// Accepted panel traffic per case: "name pixels windows" lines.
+static std::map<std::string, Budget> readManifest(const std::string &path) {
+    std::map<std::string, Budget> budgets;
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) return budgets;
+    char name[96];
+    unsigned long long pixels, windows;
+    while (fscanf(f, "%95s %llu %llu", name, &pixels, &windows) == 3) {
+        budgets[name] = Budget{ pixels, windows };
+    }
+    fclose(f);
+    return budgets;
+}
+
+static bool writeManifest(const std::string &path, const std::map<std::string, Budget> &budgets) {
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
+    for (const auto &entry : budgets) {
+        fprintf(f, "%s %llu %llu\n", entry.first.c_str(),
+                (unsigned long long)entry.second.pixels, (unsigned long long)entry.second.windows);
+    }
+    return fclose(f) == 0;
+}
+
+static void writePpm(const std::string &path, const std::vector<uint16_t> &screen) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return;
+    fprintf(f, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (uint16_t c : screen) {
+        uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3) };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+}
+
+// ===== Capture and compare =====
+static GoldenImage capture() {
+    const uint16_t* fb = tft.framebuffer();
+    int x0 = SCREEN_WIDTH, y0 = SCREEN_HEIGHT, x1 = -1, y1 = -1;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (fb[y * SCREEN_WIDTH + x] == SENTINEL_COLOR) continue;
+            x0 = min(x0, x); x1 = max(x1, x);
+            y0 = min(y0, y); y1 = max(y1, y);
+        }
+    }
+
+    GoldenImage img = { 0, 0, 0, 0, {} };
+    if (x1 < 0) return img;
+    img.x = x0; img.y = y0; img.w = x1 - x0 + 1; img.h = y1 - y0 + 1;
+    for (int y = y0; y <= y1; y++) {
+        img.pixels.insert(img.pixels.end(), fb + y * SCREEN_WIDTH + x0, fb + y * SCREEN_WIDTH + x1 + 1);
+    }
+    return img;
+}
+
+static std::vector<uint16_t> expand(const GoldenImage &img) {
+    std::vector<uint16_t> screen(SCREEN_WIDTH * SCREEN_HEIGHT, SENTINEL_COLOR);
+    for (int y = 0; y < img.h; y++) {
+        for (int x = 0; x < img.w; x++) {
+            int sx = img.x + x, sy = img.y + y;
+            if (sx < 0 || sy < 0 || sx >= SCREEN_WIDTH || sy >= SCREEN_HEIGHT) continue;
+            screen[sy * SCREEN_WIDTH + sx] = img.pixels[y * img.w + x];
+        }
+    }
+    return screen;
+}
+
+// Fresh panel for every case: no widgets, sentinel everywhere. Blocks
+// pushed from the frame can take in clean pixels, so it holds the
+// sentinel as well.
+static void resetPanel() {
+    clearScreen();
+    touchscreen.hostRelease();
+    loopOnce();
+#ifdef MICRO_UI_FRAMEBUFFER
+    microUIFrame().fillScreen(SENTINEL_COLOR);
+    microUIFlush();
+#else
+    tft.fillScreen(SENTINEL_COLOR);
+#endif
+}
+
+static bool sameImage(const GoldenImage &a, const GoldenImage &b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h && a.pixels == b.pixels;
+}
+
+struct CaseResult {
+    std::string name;
+    bool        passed;
+    std::string note;
+    uint64_t    pixels;
+    uint64_t    windows;
+    uint64_t    spritePixels;
+    double      nsPerOp;
+};
+
+int main(int argc, char** argv) {
+    std::string goldenDir = BENCH_GOLDEN_DIR;
+#ifdef BENCH_GOLDEN_BASE_DIR
+    std::string baseDir   = BENCH_GOLDEN_BASE_DIR;  // Shared images
+#else
+    std::string baseDir   = goldenDir;
+#endif
+    const char* jsonPath  = nullptr;
+    const char* diffDir   = nullptr;
+    const char* only      = nullptr;
+    bool        update    = false;
+    int         repeat    = 20;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            repeat = max(1, atoi(argv[++i]));
+        } else if (arg == "--filter" && i + 1 < argc) {
+            only = argv[++i];
+        } else if (arg == "--json" && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (arg == "--diff-dir" && i + 1 < argc) {
+            diffDir = argv[++i];
+        } else if (arg == "--golden-dir" && i + 1 < argc) {
+            goldenDir = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--update] [--repeat n] [--filter name] [--json out.json] [--diff-dir dir] [--golden-dir dir]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    microUIInit();
+    addCases();
+
+    std::string manifestPath = goldenDir + "/manifest.txt";
+    std::map<std::string, Budget> budgets = readManifest(manifestPath);
+    std::vector<CaseResult> results;
+    int failures = 0;
+
+    for (const GoldenCase &gc : cases) {
+        if (only && !strstr(gc.name.c_str(), only)) continue;
+
+        resetPanel();
+        if (gc.setup) gc.setup();
+        microUIFlush();
+        HostDisplayStats before = hostDisplayStats;
+        gc.draw(0);
+        microUIFlush();
+
+        CaseResult r;
+        r.name         = gc.name;
+        r.passed       = true;
+        r.pixels       = hostDisplayStats.pixels - before.pixels;
+        r.windows      = hostDisplayStats.windows - before.windows;
+        r.spritePixels = hostDisplayStats.spritePixels - before.spritePixels;
+
+        GoldenImage actual = capture();
+        std::string path = goldenPath(goldenDir, gc.name);
+        std::string sharedPath = goldenPath(baseDir, gc.name);
+        bool variant = baseDir != goldenDir;
+
+        if (update) {
+            GoldenImage shared;
+            if (variant && readGolden(sharedPath, shared) && sameImage(shared, actual)) {
+                remove(path.c_str());           // The shared image covers it
+            } else if (!writeGolden(path, actual)) {
+                r.passed = false;
+                r.note = "cannot write " + path;
+            }
+            budgets[gc.name] = Budget{ r.pixels, r.windows };
+        } else {
+            GoldenImage golden;
+            if (!readGolden(path, golden) && !(variant && readGolden(sharedPath, golden))) {
+                r.passed = false;
+                r.note = "missing golden";
+            } else {
+                std::vector<uint16_t> want = expand(golden);
+                std::vector<uint16_t> got  = expand(actual);
+                int diffs = 0, firstX = -1, firstY = -1;
+                for (size_t i = 0; i < want.size(); i++) {
+                    if (want[i] == got[i]) continue;
+                    if (diffs++ == 0) { firstX = i % SCREEN_WIDTH; firstY = i / SCREEN_WIDTH; }
+                }
+                if (diffs) {
+                    r.passed = false;
+                    r.note = fmt("%d pixels differ, first at %d,%d", diffs, firstX, firstY);
+                    if (diffDir) {
+                        writePpm(std::string(diffDir) + "/" + gc.name + ".expected.ppm", want);
+                        writePpm(std::string(diffDir) + "/" + gc.name + ".actual.ppm", got);
+                    }
+                }
+            }
+
+            auto budget = budgets.find(gc.name);
+            if (budget == budgets.end()) {
+                r.passed = false;
+                r.note += r.note.empty() ? "no budget" : ", no budget";
+            } else if (r.pixels > budget->second.pixels || r.windows > budget->second.windows) {
+                r.passed = false;
+                r.note += fmt("%spanel traffic up: %llu px / %llu windows, budget %llu / %llu",
+                              r.note.empty() ? "" : ", ",
+                              (unsigned long long)r.pixels, (unsigned long long)r.windows,
+                              (unsigned long long)budget->second.pixels, (unsigned long long)budget->second.windows);
+            } else if (r.pixels < budget->second.pixels || r.windows < budget->second.windows) {
+                r.note += r.note.empty() ? "under budget" : ", under budget";
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int pass = 1; pass <= repeat; pass++) {
+            gc.draw(pass);
+            microUIFlush();
+        }
+        r.nsPerOp = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / repeat;
+
+        if (!r.passed) failures++;
+        results.push_back(r);
+    }
+
+    if (update && !writeManifest(manifestPath, budgets)) {
+        fprintf(stderr, "cannot write %s\n", manifestPath.c_str());
+        return 1;
+    }
+
+    printf("%-30s %6s %10s %8s %12s %12s  %s\n", "case", "result", "pixels", "windows", "sprite px", "ns/op", "");
+    for (const CaseResult &r : results) {
+        printf("%-30s %6s %10llu %8llu %12llu %12.1f  %s\n", r.name.c_str(),
+               update ? "saved" : (r.passed ? "ok" : "FAIL"),
+               (unsigned long long)r.pixels, (unsigned long long)r.windows,
+               (unsigned long long)r.spritePixels, r.nsPerOp, r.note.c_str());
+    }
+    printf("%zu cases, %d failed\n", results.size(), failures);
+
+    if (jsonPath) {
+        FILE* f = fopen(jsonPath, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(f, "{\n  \"cases\": [\n");
+        for (size_t i = 0; i < results.size(); i++) {
+            const CaseResult &r = results[i];
+            fprintf(f, "    {\"name\": \"%s\", \"passed\": %s, \"pixels\": %llu, \"bytes\": %llu, \"windows\": %llu, "
+                       "\"sprite_pixels\": %llu, \"ns_per_op\": %.2f}%s\n",
+                    r.name.c_str(), r.passed ? "true" : "false", (unsigned long long)r.pixels,
+                    (unsigned long long)r.pixels * 2, (unsigned long long)r.windows,
+                    (unsigned long long)r.spritePixels, r.nsPerOp, i + 1 < results.size() ? "," : "");
+        }
+        fprintf(f, "  ]\n}\n");
+        fclose(f);
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+// Touch-to-photon latency on the host.
+//
+// Links micro_ui built with MICRO_UI_LATENCY and replays scripted
+// touches: taps on a four-button menu, a slider drag, a list scroll and
+// taps that slide to another screen.
+// The stub panel charges every pixel and address window its SPI bus
+// time (hostPanelSpiHz), so the figures depend only on what micro_ui
+// sends and are the same on every run and every machine. CPU time is
+// not modelled; on a board it adds to these.
+//
+// --check replays each script twice and fails unless both runs give
+// identical statistics.
+//
+//   micro_ui_latency [--spi-mhz n] [--check]
+#include "bench_common.h"
+#include <string>
+
+static void noopButton(const char*) {}
+static void noopSlider(int) {}
+static void noopList(int) {}
+
+static void logRow(int row, int, char* out, size_t len) {
+    snprintf(out, len, "#%04d  %d.%02d kg", row, (row * 37) % 100, (row * 13) % 100);
+}
+
+// Four 150x110 buttons, as on the example's menu screen; each is
+// tapped ten times.
+static void menuTaps() {
+    addButton(5, 5, 150, 110, "BACK", noopButton, 4);
+    addButton(165, 5, 150, 110, "FILTERS", noopButton, 4);
+    addButton(5, 125, 150, 110, "CAL", noopButton, 4);
+    addButton(165, 125, 150, 110, "OTHER", noopButton, 4);
+    drawAllButtons();
+    for (int n = 0; n < 40; n++) {
+        touchAt((n & 1) ? 240 : 80, (n & 2) ? 180 : 60);
+        loopOnce();
+        touchscreen.hostRelease();
+        loopOnce();
+    }
+}
+
+// The thumb is dragged end to end and back in 6 px steps.
+static void sliderDrag() {
+    addSlider(10, 100, 300, 50, 0, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    drawAllSliders();
+    for (int x = 25; x <= 295; x += 6) { touchAt(x, 125); loopOnce(); }
+    for (int x = 295; x >= 25; x -= 6) { touchAt(x, 125); loopOnce(); }
+    touchscreen.hostRelease();
+    loopOnce();
+}
+
+static void listScroll() {
+    addList(10, 20, 300, 200, 1000, logRow, noopList);
+    drawAllLists();
+    for (int pass = 0; pass < 5; pass++) {
+        for (int y = 200; y >= 40; y -= 8) { touchAt(150, y); loopOnce(); }
+        touchscreen.hostRelease();
+        loopOnce();
+    }
+}
+
+// Each tap slides between two screens; the response is the whole
+// transition, so the histogram shows its completion time.
+static void slideMenu();
+
+static void slideBack(const char*) {
+    showScreen(slideMenu, TRANSITION_SLIDE_RIGHT);
+}
+
+static void slideFilters() {
+    clearScreen();
+    addButton(0, 0, 84, 50, "X", slideBack, 4, TFT_RED, TFT_BLACK);
+    for (int row = 0; row < 4; row++) addSlider(5, 50 + row * 50, 244, 50, row * 25, noopSlider, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    drawAllButtons();
+    drawAllSliders();
+}
+
+static void slideForward(const char*) {
+    showScreen(slideFilters, TRANSITION_SLIDE_LEFT);
+}
+
+static void slideMenu() {
+    clearScreen();
+    addButton(5, 5, 150, 110, "FILTERS", slideForward, 4);
+    addButton(165, 5, 150, 110, "BACK", noopButton, 4);
+    drawAllButtons();
+}
+
+static void screenSlide() {
+    slideMenu();
+    for (int n = 0; n < 10; n++) {
+        touchAt(40, 25);                // FILTERS, then X
+        loopOnce();
+        hostAdvanceMicros(50000);
+        touchscreen.hostRelease();
+        loopOnce();
+    }
+}
+
+struct Script {
+    const char* name;
+    void (*run)();
+};
+
+static const Script scripts[] = {
+    { "menu_taps",   menuTaps },
+    { "slider_drag", sliderDrag },
+    { "list_scroll", listScroll },
+    { "screen_slide", screenSlide },
+};
+
+static LatencyStats replay(const Script &script) {
+    clearScreen();
+    hostSetMicros(0);
+    hostBusTimeReset();
+    microUILatencyReset();
+    transitionStats = TransitionStats();
+    script.run();
+    touchscreen.hostRelease();
+    loopOnce();
+    return latencyStats;
+}
+
+int main(int argc, char** argv) {
+    uint32_t spiMhz = 40;
+    bool     check  = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--spi-mhz" && i + 1 < argc) {
+            spiMhz = max(1, atoi(argv[++i]));
+        } else if (arg == "--check") {
+            check = true;
+        } else {
+            fprintf(stderr, "usage: %s [--spi-mhz n] [--check]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    microUIInit();
+    hostPanelSpiHz = spiMhz * 1000000;
+
+    int failures = 0;
+    for (const Script &script : scripts) {
+        LatencyStats first = replay(script);
+        printf("== %s, %lu MHz SPI\n", script.name, (unsigned long)spiMhz);
+        microUILatencyDump(Serial);
+        if (transitionStats.frames) {
+            printf("last transition: %u frames, %u over the %u us budget, slowest %lu us, done in %lu us\n",
+                   transitionStats.frames, transitionStats.framesOverBudget, (unsigned)TRANSITION_FRAME_US,
+                   (unsigned long)transitionStats.slowestFrameMicros, (unsigned long)transitionStats.totalMicros);
+        }
+
+        if (check) {
+            LatencyStats second = replay(script);
+            bool same = memcmp(&first, &second, sizeof(first)) == 0 && first.count > 0;
+            printf("%s: %s\n", script.name, same ? "deterministic" : "FAIL, runs differ or nothing recorded");
+            if (!same) failures++;
+        }
+        printf("\n");
+    }
+    return failures ? 1 : 0;
+}
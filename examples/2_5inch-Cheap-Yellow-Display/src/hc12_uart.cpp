@@ -0,0 +1,289 @@
+// HC-12 hardware UART ingestion with a lock-free ring buffer
+#include "hc12_uart.h"
+#include <atomic>
+#include <string.h>
+
+static_assert((HC12_RING_SIZE & (HC12_RING_SIZE - 1)) == 0, "HC12_RING_SIZE must be a power of two");
+static_assert((HC12_CHUNK_SLOTS & (HC12_CHUNK_SLOTS - 1)) == 0, "HC12_CHUNK_SLOTS must be a power of two");
+
+// ===== Ring Buffer =====
+// Single producer (reader task) / single consumer (loop). Head and tail
+// are free-running byte counters; only the low bits index the storage.
+struct ChunkSlot {
+    uint32_t start;     // Ring position of the first byte
+    uint32_t end;       // Ring position one past the last byte
+    uint32_t us;        // micros() when the chunk left the UART driver
+};
+
+static uint8_t                  ring[HC12_RING_SIZE];
+static std::atomic<uint32_t>    ringHead(0);
+static std::atomic<uint32_t>    ringTail(0);
+
+static ChunkSlot                chunkRing[HC12_CHUNK_SLOTS];
+static std::atomic<uint32_t>    chunkHead(0);
+static std::atomic<uint32_t>    chunkTail(0);
+
+static volatile HC12Stats       stats       = {};
+static QueueHandle_t            rxEvents    = nullptr;
+static TaskHandle_t             rxTask      = nullptr;
+
+// Move `pending` bytes from the UART driver into the ring. Bytes that
+// do not fit are read into a scratch buffer and counted as overruns.
+static void ringFill(size_t pending, uint32_t stamp) {
+    uint32_t start = ringHead.load(std::memory_order_relaxed);
+    uint32_t head  = start;
+
+    while (pending > 0) {
+        uint32_t tail   = ringTail.load(std::memory_order_acquire);
+        size_t   space  = HC12_RING_SIZE - (head - tail);
+
+        if (space == 0) {
+            uint8_t scratch[32];
+            int n = uart_read_bytes(HC12_UART_NUM, scratch, min(pending, sizeof(scratch)), 0);
+            if (n <= 0) break;
+            stats.ringOverruns += n;
+            pending -= n;
+            continue;
+        }
+
+        size_t offset = head & (HC12_RING_SIZE - 1);
+        size_t n = min(min(space, pending), (size_t)(HC12_RING_SIZE - offset));
+        int got = uart_read_bytes(HC12_UART_NUM, &ring[offset], n, 0);
+        if (got <= 0) break;
+
+        head += got;
+        ringHead.store(head, std::memory_order_release);
+        pending -= got;
+    }
+
+    if (head == start) return;
+    stats.bytesReceived += head - start;
+    stats.chunks++;
+
+    // Chunk timestamps are best effort; if the slots are exhausted the
+    // bytes are still delivered and simply inherit the next timestamp.
+    uint32_t ch = chunkHead.load(std::memory_order_relaxed);
+    if (ch - chunkTail.load(std::memory_order_acquire) < HC12_CHUNK_SLOTS) {
+        ChunkSlot &slot = chunkRing[ch & (HC12_CHUNK_SLOTS - 1)];
+        slot.start = start;
+        slot.end = head;
+        slot.us = stamp;
+        chunkHead.store(ch + 1, std::memory_order_release);
+    }
+}
+
+static void hc12RxTask(void*) {
+    uart_event_t event;
+    for (;;) {
+        if (xQueueReceive(rxEvents, &event, portMAX_DELAY) != pdTRUE) continue;
+
+        switch (event.type) {
+            case UART_DATA:
+                ringFill(event.size, micros());
+                break;
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                // The driver stops receiving until drained; start clean.
+                stats.fifoOverruns++;
+                uart_flush_input(HC12_UART_NUM);
+                xQueueReset(rxEvents);
+                break;
+            case UART_BREAK:
+            case UART_PARITY_ERR:
+            case UART_FRAME_ERR:
+                stats.lineErrors++;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// ===== Public API =====
+bool hc12Begin(int rxPin, int txPin, uint32_t baud) {
+    if (rxTask) {
+        return uart_set_baudrate(HC12_UART_NUM, baud) == ESP_OK;
+    }
+
+    uart_config_t cfg = {};
+    cfg.baud_rate = baud;
+    cfg.data_bits = UART_DATA_8_BITS;
+    cfg.parity    = UART_PARITY_DISABLE;
+    cfg.stop_bits = UART_STOP_BITS_1;
+    cfg.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+
+    if (uart_driver_install(HC12_UART_NUM, HC12_UART_RX_BUFFER, 0, HC12_UART_EVENTS, &rxEvents, 0) != ESP_OK) {
+        return false;
+    }
+    uart_param_config(HC12_UART_NUM, &cfg);
+    uart_set_pin(HC12_UART_NUM, txPin, rxPin, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    uart_set_rx_full_threshold(HC12_UART_NUM, HC12_RX_FULL_THRESHOLD);
+    uart_set_rx_timeout(HC12_UART_NUM, HC12_RX_IDLE_SYMBOLS);
+
+    return xTaskCreatePinnedToCore(hc12RxTask, "hc12rx", HC12_TASK_STACK, nullptr,
+                                   HC12_TASK_PRIORITY, &rxTask, HC12_TASK_CORE) == pdPASS;
+}
+
+HC12Batch hc12Read(HC12Span out) {
+    HC12Batch batch = {};
+    if (!out.data || out.len == 0) return batch;
+
+    uint32_t tail = ringTail.load(std::memory_order_relaxed);
+    uint32_t head = ringHead.load(std::memory_order_acquire);
+    size_t   n    = min((size_t)(head - tail), out.len);
+    if (n == 0) return batch;
+
+    size_t offset = tail & (HC12_RING_SIZE - 1);
+    size_t first  = min(n, (size_t)(HC12_RING_SIZE - offset));
+    memcpy(out.data, &ring[offset], first);
+    if (n > first) memcpy(out.data + first, ring, n - first);
+
+    uint32_t newTail = tail + n;
+    ringTail.store(newTail, std::memory_order_release);
+    batch.len = n;
+
+    // Report every chunk this batch touched; retire the ones fully consumed.
+    uint32_t ct = chunkTail.load(std::memory_order_relaxed);
+    uint32_t ch = chunkHead.load(std::memory_order_acquire);
+    while (ct != ch) {
+        const ChunkSlot &slot = chunkRing[ct & (HC12_CHUNK_SLOTS - 1)];
+        if ((int32_t)(slot.start - newTail) >= 0) break;
+        if (batch.chunks == 0) batch.firstUs = slot.us;
+        batch.lastUs = slot.us;
+        batch.chunks++;
+        if ((int32_t)(slot.end - newTail) > 0) break;
+        ct++;
+    }
+    chunkTail.store(ct, std::memory_order_release);
+
+    return batch;
+}
+
+size_t hc12Available() {
+    return ringHead.load(std::memory_order_acquire) - ringTail.load(std::memory_order_relaxed);
+}
+
+size_t hc12Write(const char* text) {
+    if (!text || !rxTask) return 0;
+    int n = uart_write_bytes(HC12_UART_NUM, text, strlen(text));
+    return n > 0 ? n : 0;
+}
+
+void hc12Discard() {
+    ringTail.store(ringHead.load(std::memory_order_acquire), std::memory_order_release);
+    chunkTail.store(chunkHead.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+void hc12GetStats(HC12Stats &out) {
+    out.bytesReceived = stats.bytesReceived;
+    out.chunks        = stats.chunks;
+    out.ringOverruns  = stats.ringOverruns;
+    out.fifoOverruns  = stats.fifoOverruns;
+    out.lineErrors    = stats.lineErrors;
+}
+
+// ===== AT Configuration =====
+static HC12ConfigState      cfgState        = HC12_CFG_IDLE;
+static const HC12Command*   cfgCommands     = nullptr;
+static uint8_t              cfgCount        = 0;
+static uint8_t              cfgIndex        = 0;
+static uint8_t              cfgTimeouts     = 0;
+static int                  cfgSetPin       = -1;
+static unsigned long        cfgSince        = 0;
+static char                 cfgLine[HC12_AT_LINE];
+static uint8_t              cfgLinePos      = 0;
+
+static void cfgEnter(HC12ConfigState state) {
+    cfgState = state;
+    cfgSince = millis();
+}
+
+// Collect reply bytes into lines; true once a line starts with `expect`.
+static bool cfgReplyMatched(const char* expect) {
+    uint8_t rx[32];
+    HC12Batch batch = hc12Read(HC12Span{rx, sizeof(rx)});
+    bool matched = false;
+
+    for (size_t n = 0; n < batch.len; n++) {
+        char c = rx[n];
+        if (c == '\r') continue;
+        if (c != '\n') {
+            if (cfgLinePos < sizeof(cfgLine) - 1) cfgLine[cfgLinePos++] = c;
+            continue;
+        }
+        cfgLine[cfgLinePos] = '\0';
+        cfgLinePos = 0;
+        if (cfgLine[0] == '\0') continue;
+        Serial.println(cfgLine); // Echo replies to the Serial Monitor
+        if (expect && strncmp(cfgLine, expect, strlen(expect)) == 0) matched = true;
+    }
+    return matched;
+}
+
+void hc12ConfigBegin(int setPin, const HC12Command* commands, uint8_t count) {
+    cfgSetPin = setPin;
+    cfgCommands = commands;
+    cfgCount = commands ? count : 0;
+    cfgIndex = 0;
+    cfgTimeouts = 0;
+    cfgLinePos = 0;
+
+    pinMode(cfgSetPin, OUTPUT);
+    digitalWrite(cfgSetPin, LOW);  // Enter AT command mode
+    cfgEnter(HC12_CFG_ENTER);
+}
+
+bool hc12ConfigService() {
+    unsigned long elapsed = millis() - cfgSince;
+
+    switch (cfgState) {
+        case HC12_CFG_IDLE:
+        case HC12_CFG_DONE:
+            return true;
+
+        case HC12_CFG_ENTER:
+            if (elapsed < HC12_AT_ENTER_MS) return false;
+            hc12Discard();
+            cfgEnter(HC12_CFG_SEND);
+            return false;
+
+        case HC12_CFG_SEND:
+            if (cfgIndex >= cfgCount) {
+                digitalWrite(cfgSetPin, HIGH); // Back to transparent mode
+                cfgEnter(HC12_CFG_EXIT);
+                return false;
+            }
+            hc12Write(cfgCommands[cfgIndex].command);
+            hc12Write("\r\n");
+            cfgEnter(HC12_CFG_WAIT);
+            return false;
+
+        case HC12_CFG_WAIT:
+            if (cfgReplyMatched(cfgCommands[cfgIndex].expect)) {
+                cfgIndex++;
+                cfgEnter(HC12_CFG_SEND);
+            } else if (elapsed >= HC12_AT_TIMEOUT_MS) {
+                Serial.print("HC-12 no reply to ");
+                Serial.println(cfgCommands[cfgIndex].command);
+                cfgTimeouts++;
+                cfgIndex++;
+                cfgEnter(HC12_CFG_SEND);
+            }
+            return false;
+
+        case HC12_CFG_EXIT:
+            if (elapsed < HC12_AT_EXIT_MS) return false;
+            hc12Discard(); // Drop anything received while switching modes
+            cfgEnter(HC12_CFG_DONE);
+            return true;
+    }
+    return true;
+}
+
+HC12ConfigState hc12ConfigState() {
+    return cfgState;
+}
+
+uint8_t hc12ConfigTimeouts() {
+    return cfgTimeouts;
+}
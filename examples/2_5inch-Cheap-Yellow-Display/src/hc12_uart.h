@@ -0,0 +1,92 @@
+/* HC-12 ingestion over an ESP32 hardware UART.
+
+   The UART driver collects bytes in its RX FIFO and raises an event
+   on FIFO threshold or line idle. A small reader task lifts each
+   chunk straight into a lock-free single-producer/single-consumer
+   ring buffer and stamps it with micros(). The main loop drains the
+   ring once per pass with hc12Read(), so long pushSprite() calls no
+   longer cost received bytes and no CPU is spent bit-banging.
+*/
+
+#ifndef HC12_UART_H
+#define HC12_UART_H
+
+#include <Arduino.h>
+#include <driver/uart.h>
+
+#define HC12_UART_NUM           UART_NUM_2
+#define HC12_UART_RX_BUFFER     512     // Driver-side buffer behind the 128 byte FIFO
+#define HC12_UART_EVENTS        16
+#define HC12_RX_FULL_THRESHOLD  32      // Raise an event once the FIFO holds this many bytes
+#define HC12_RX_IDLE_SYMBOLS    4       // ... or after this many idle symbol times
+
+#define HC12_RING_SIZE          1024    // Must be a power of two
+#define HC12_CHUNK_SLOTS        32      // Must be a power of two
+
+#define HC12_TASK_STACK         2048
+#define HC12_TASK_PRIORITY      (configMAX_PRIORITIES - 2)
+#define HC12_TASK_CORE          0       // Keep the reader off the Arduino loop core
+
+// AT configuration timing (HC-12 datasheet: >40 ms after SET goes low,
+// ~80 ms after it goes high before transparent mode is usable)
+#define HC12_AT_ENTER_MS        50
+#define HC12_AT_EXIT_MS         80
+#define HC12_AT_TIMEOUT_MS      300     // Fallback if the expected reply never shows
+#define HC12_AT_LINE            32
+
+// Destination for a batch read. Any byte buffer will do.
+struct HC12Span {
+    uint8_t* data;
+    size_t   len;
+};
+
+// Result of one hc12Read(): how many bytes were copied and when the
+// chunks they came from were lifted off the UART.
+struct HC12Batch {
+    size_t   len;
+    uint16_t chunks;        // Chunks fully or partly covered by this batch
+    uint32_t firstUs;       // micros() of the oldest chunk in the batch
+    uint32_t lastUs;        // micros() of the newest chunk in the batch
+};
+
+struct HC12Stats {
+    uint32_t bytesReceived; // Bytes accepted into the ring
+    uint32_t chunks;        // Chunks accepted into the ring
+    uint32_t ringOverruns;  // Bytes dropped because the ring was full
+    uint32_t fifoOverruns;  // UART FIFO / driver buffer overflow events
+    uint32_t lineErrors;    // Frame, parity and break events
+};
+
+// One AT command and the reply prefix that completes it.
+struct HC12Command {
+    const char* command;    // Sent with a trailing CR/LF
+    const char* expect;     // Reply line prefix, e.g. "OK+FU3"
+};
+
+enum HC12ConfigState {
+    HC12_CFG_IDLE,
+    HC12_CFG_ENTER,         // SET pulled low, waiting for AT mode
+    HC12_CFG_SEND,
+    HC12_CFG_WAIT,          // Waiting for the expected reply or timeout
+    HC12_CFG_EXIT,          // SET released, waiting for transparent mode
+    HC12_CFG_DONE
+};
+
+bool      hc12Begin(int rxPin, int txPin, uint32_t baud);
+HC12Batch hc12Read(HC12Span out);
+size_t    hc12Available();
+size_t    hc12Write(const char* text);
+void      hc12Discard();
+void      hc12GetStats(HC12Stats &out);
+
+// Non-blocking AT configuration. hc12ConfigBegin() pulls SET low and
+// returns at once; hc12ConfigService() advances one step per call and
+// returns true once the link is back in transparent mode. Commands
+// complete as soon as their reply arrives, or after HC12_AT_TIMEOUT_MS.
+// The command table must outlive the configuration run.
+void      hc12ConfigBegin(int setPin, const HC12Command* commands, uint8_t count);
+bool      hc12ConfigService();
+HC12ConfigState hc12ConfigState();
+uint8_t   hc12ConfigTimeouts();
+
+#endif
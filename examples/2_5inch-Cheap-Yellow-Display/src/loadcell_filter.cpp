@@ -0,0 +1,304 @@
+// Load cell filter chain: trimmed mean, adaptive smoothing, vibration
+// damping, display locking and conversion to weight.
+#include "loadcell_filter.h"
+#include "telemetry.h"
+#include <algorithm>
+#include <vector>
+
+// Lock/unlock transitions reported in TELEM_LOCK record codes
+#define LOCK_EVT_FORCE_UNLOCK   0x01
+#define LOCK_EVT_LOCKED         0x02
+
+// advancedFilteredADC() outcomes reported in TELEM_FILTER record codes
+#define FILTER_EVT_SMOOTHED     0
+#define FILTER_EVT_OUT_OF_RANGE 1
+#define FILTER_EVT_STEP         2
+
+static_assert(FILTER_STAGES == TELEM_STAGES, "Telemetry samples carry one value per filter stage");
+
+std::vector<float> meanBuffer;
+
+float meanDeltaSmoothed   = 0;
+float filterDeltaSmoothed = 0;
+float lockDeltaSmoothed   = 0;
+float dampDeltaSmoothed   = 0;
+float weightDeltaSmoothed = 0;
+
+// One pass through every stage for a raw HC-12 reading. Stage outputs
+// and their change since the previous reading land in `step`; the
+// smoothed deltas shown on the FILTERS screen are updated in place.
+float runFilterChain(long raw, FilterStep &step) {
+    float filteredValue = raw;
+    float weight;
+
+    const float deltaSmoothFactor = 0.1f;  // Lower = more smoothing
+
+    // TRIMMED MEAN STAGE
+    {
+        // Use a static variable to store the previous cycle's output.
+        static float lastTrimmed = filteredValue;
+        float trimmed = getTrimmedMean(filteredValue);
+        step.delta[STAGE_MEAN] = abs(trimmed - lastTrimmed);
+        meanDeltaSmoothed += (step.delta[STAGE_MEAN] - meanDeltaSmoothed) * deltaSmoothFactor;
+        lastTrimmed = trimmed;        // update stored output for next cycle
+        step.out[STAGE_MEAN] = trimmed;
+        filteredValue = trimmed;        // pass stage output on
+    }
+
+    // ADVANCED FILTER STAGE
+    {
+        static float lastAdvanced = filteredValue;
+        float advanced = advancedFilteredADC(filteredValue);
+        step.delta[STAGE_FILTER] = abs(advanced - lastAdvanced);
+        filterDeltaSmoothed += (step.delta[STAGE_FILTER] - filterDeltaSmoothed) * deltaSmoothFactor;
+        lastAdvanced = advanced;
+        step.out[STAGE_FILTER] = advanced;
+        filteredValue = advanced;
+    }
+
+    // VIBRATION FILTER STAGE
+    {
+        static float lastVibration = filteredValue;
+        float vibration = getVibrationFilteredADC(filteredValue);
+        step.delta[STAGE_DAMP] = abs(vibration - lastVibration);
+        dampDeltaSmoothed += (step.delta[STAGE_DAMP] - dampDeltaSmoothed) * deltaSmoothFactor;
+        lastVibration = vibration;
+        step.out[STAGE_DAMP] = vibration;
+        filteredValue = vibration;
+    }
+
+    // LOCK FILTER STAGE
+    {
+        static float lastLocked = filteredValue;
+        float locked = getLockedADC(filteredValue);
+        step.delta[STAGE_LOCK] = abs(locked - lastLocked);
+        lockDeltaSmoothed += (step.delta[STAGE_LOCK] - lockDeltaSmoothed) * deltaSmoothFactor;
+        lastLocked = locked;
+        step.out[STAGE_LOCK] = locked;
+        filteredValue = locked;
+    }
+
+    // FINAL STAGE: CONVERT TO WEIGHT
+    {
+        static float lastWeightOutput = filteredValue;
+        weight = ADC2Weight(filteredValue);
+        step.delta[STAGE_WEIGHT] = abs(weight - lastWeightOutput);
+        weightDeltaSmoothed += (step.delta[STAGE_WEIGHT] - weightDeltaSmoothed) * deltaSmoothFactor;
+        lastWeightOutput = weight;
+        step.out[STAGE_WEIGHT] = weight;
+    }
+
+    float scale_factor = pow(10, config.dp+1); 
+    weight = round(weight * scale_factor) / scale_factor;
+
+    return weight;
+}
+
+inline float constrainFloat(float val, float minVal, float maxVal) {
+    if (val < minVal) return minVal;
+    else if (val > maxVal) return maxVal;
+    else return val;
+}
+
+float getTrimmedMean(long filteredValue) {
+    if(config.meanSlider == 0) {
+        return filteredValue;
+    }
+
+    int maxSize = max(5, config.meanSlider);  // Minimum size to make trimming meaningful
+    meanBuffer.push_back(filteredValue);
+
+    // Keep buffer size in check
+    if (meanBuffer.size() > maxSize)
+        meanBuffer.erase(meanBuffer.begin());
+
+    // Create a sorted copy for trimmed processing
+    std::vector<float> sorted = meanBuffer;
+    std::sort(sorted.begin(), sorted.end());
+
+    // Calculate trim count (e.g., 10% on each side)
+    int trimCount = sorted.size() * 10 / 100;
+    trimCount = min(trimCount, (int)sorted.size() / 2);  // Avoid trimming too much
+
+    // Compute trimmed mean
+    float sum = 0;
+    int count = 0;
+    for (int i = trimCount; i < (int)sorted.size() - trimCount; ++i) {
+        sum += sorted[i];
+        count++;
+    }
+
+    return count > 0 ? sum / count : filteredValue;
+}
+
+float advancedFilteredADC(float input) {
+    static float output = 0;
+    static bool firstRun = true;
+
+    // Handle filter disabled: no filtering at all.
+    if (config.filterSlider == 0) {
+        output = input;
+        firstRun = true;
+        return input;
+    }
+
+    // First-time setup: initialize output.
+    if (firstRun) {
+        output = input;
+        firstRun = false;
+        return output;
+    }
+
+    // Define working range
+    float range = std::max<float>(1.0f, config.fso_raw);
+    float safeMin = config.zero_raw - range * 0.5f;
+    float safeMax = config.zero_raw + range * 1.5f;
+
+    // Optional: ignore inputs way outside the expected bounds.
+    if (input < safeMin || input > safeMax) {
+#ifdef DEBUG_FILTER
+        const float trace[] = { input, output };
+        telemetryEvent(TELEM_FILTER, FILTER_EVT_OUT_OF_RANGE, trace, 2);
+#endif
+        return output;
+    }
+
+    // --- Invert the slider mapping ---
+    // Our new normalized value 'u' is defined so that u=1 when slider=1 (i.e. least filtering)
+    // and u=0 when slider=100 (i.e. best filtering).
+    float u = constrain((100.0f - config.filterSlider) / 99.0f, 0.0f, 1.0f);
+
+    // Map u nonlinearly for smoothing factor and step limit.
+    float alpha = u * u;  // When u=1 (slider at 1), alpha=1 (raw, no filtering). When u=0 (slider at 100), alpha=0.
+    float stepLimit = range * (0.001f + pow(u, 2.5f) * 0.05f);  // Higher u gives a higher allowable delta.
+
+    float delta = input - output;
+    bool stepOverride = false;
+
+    // If the absolute difference exceeds stepLimit, snap to the new input.
+    if (fabs(delta) > stepLimit) {
+        output = input;
+        stepOverride = true;
+    } else {
+        // Otherwise, update using exponential smoothing.
+        output += alpha * delta;
+    }
+
+#ifdef DEBUG_FILTER
+    const float trace[] = { input, output, delta, alpha, stepLimit };
+    telemetryEvent(TELEM_FILTER, stepOverride ? FILTER_EVT_STEP : FILTER_EVT_SMOOTHED, trace, 5);
+#endif
+
+    return output;
+}
+
+
+float getLockedADC(float filteredValue) {
+    static float lockedValue = 0;       // Committed lock value
+    static float visualOutput = 0;      // Smooth output
+    static float pendingValue = 0;      // Candidate for locking
+    static int lockCount = 0;           // Stability counter
+    int lockEvents = 0;                 // LOCK_EVT_* seen this call
+
+    if (config.lockingSlider == 0) {
+        lockedValue = filteredValue;
+        visualOutput = filteredValue;
+        pendingValue = 0;
+        lockCount = 0;
+        return filteredValue;
+    }
+
+    float stabilityFactor = constrain(config.lockingSlider / 100.0f, 0.01f, 1.0f);
+
+    
+    // Full slider (100) = ~3s lock time at 25Hz update (i.e. 75 samples)
+    const int maxLockCount = 75; // ~3s at 25Hz
+    const int lockCountNeeded = 1 + (int)(stabilityFactor * (maxLockCount - 1));
+
+    const float flickerThreshold = (float)config.fso_raw / config.divisions * (1.0f + stabilityFactor * 1.5f);
+    const float easing = 0.01f + (1.0f - stabilityFactor) * 0.25f;
+
+    float deltaToLocked = fabs(filteredValue - lockedValue);
+    float deltaToPending = fabs(filteredValue - pendingValue);
+
+    const float unlockThreshold = flickerThreshold * 3.0f;  // Or tune this multiplier
+
+    if (fabs(filteredValue - lockedValue) > unlockThreshold) {
+        lockedValue = filteredValue;  // Or 0 if you want it to drop fast
+        pendingValue = 0;
+        lockCount = 0;
+        lockEvents |= LOCK_EVT_FORCE_UNLOCK;
+    }
+
+    if (deltaToLocked < flickerThreshold) {
+        pendingValue = 0;
+        lockCount = 0;
+    } else {
+        if (pendingValue == 0 || deltaToPending >= flickerThreshold) {
+            pendingValue = filteredValue;
+            lockCount = 1;
+        } else {
+            lockCount++;
+            if (lockCount >= lockCountNeeded) {
+                lockedValue = pendingValue;
+                lockEvents |= LOCK_EVT_LOCKED;
+                pendingValue = 0;
+                lockCount = 0;
+            }
+        }
+    }
+
+    visualOutput = visualOutput * (1.0f - easing) + lockedValue * easing;
+
+#ifdef DEBUG_LOCK
+    const float trace[] = { filteredValue, deltaToLocked, flickerThreshold, easing,
+                            (float)lockCountNeeded, (float)lockCount, lockedValue, visualOutput };
+    telemetryEvent(TELEM_LOCK, lockEvents, trace, 8);
+#endif
+
+    return visualOutput;
+}
+
+float getVibrationFilteredADC(float filteredValue) {
+    static float vibDisplay = 0;
+    static float vibHistory[6] = {0};
+    static int vibIndex = 0;
+
+    if(config.vibrationSlider == 0) {
+        return filteredValue;
+    }
+    // Convert slider to float (0.0 to 1.0)
+    float vibrationFiltering = (float)config.vibrationSlider / 100.0f;
+    if (vibrationFiltering < 0.0f) vibrationFiltering = 0.0f;
+    if (vibrationFiltering > 1.0f) vibrationFiltering = 1.0f;
+
+    // Damping control: higher damping at low slider values
+    float smoothness = 1.0f - vibrationFiltering;  // 1 = max damping
+    float dampingAlpha = 0.01f + (smoothness * 0.29f);  // Range: 0.01 – 0.30
+
+    // IIR smoothing
+    vibDisplay = dampingAlpha * filteredValue + (1.0f - dampingAlpha) * vibDisplay;
+
+    // Cadence rejection using moving average
+    float movingAvg = 0;
+    for (int i = 0; i < 6; i++) movingAvg += vibHistory[i];
+    movingAvg /= 6.0f;
+
+    vibHistory[vibIndex++] = vibDisplay;
+    if (vibIndex >= 6) vibIndex = 0;
+
+    // If filtering is aggressive and variation is subtle, freeze at average
+    if (vibrationFiltering > 0.8f && fabs(vibDisplay - movingAvg) < 0.002f) {
+        vibDisplay = movingAvg;
+    }
+
+    return vibDisplay;
+}
+
+float ADC2Weight(float filteredValue) {
+    float weight_kg = 0.0;
+    if (config.fso_raw != config.zero_raw) { 
+        weight_kg = round(((float)(filteredValue - config.zero_raw) / (float)(config.fso_raw - config.zero_raw)) * config.divisions) * ((float)config.capacity / (float)config.divisions);
+    }
+    return weight_kg;
+}
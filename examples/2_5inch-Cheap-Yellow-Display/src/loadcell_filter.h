@@ -0,0 +1,55 @@
+// Load cell filter chain shared by the firmware and the host benchmarks
+
+#ifndef LOADCELL_FILTER_H
+#define LOADCELL_FILTER_H
+
+#include <Arduino.h>
+
+//#define DEBUG_FILTER
+//#define DEBUG_LOCK
+
+struct CalibrationData {
+    int capacity;        // capacity (kg)
+    int divisions;       // Number of discrete steps
+    int dp;              // 0 1 2 3
+    long zero_raw;       // gathered from getZero()
+    long cal_kg;         // entered from doCalibration()
+    long cal_raw;        // gathered from getCalibration()
+    long fso_raw;        // from calculateFSO()
+    int meanSlider;      // getTrimmedMean()
+    int filterSlider;    // advancedFilteredADC()
+    int vibrationSlider; // getVibrationFilteredADC()
+    int lockingSlider;   // getStableADC()
+};
+
+extern CalibrationData config;
+
+enum FilterStage {
+    STAGE_MEAN,
+    STAGE_FILTER,
+    STAGE_DAMP,
+    STAGE_LOCK,
+    STAGE_WEIGHT,
+    FILTER_STAGES
+};
+
+struct FilterStep {
+    float out[FILTER_STAGES];       // Output of each stage
+    float delta[FILTER_STAGES];     // |change| of each stage output since the last reading
+};
+
+extern float meanDeltaSmoothed;
+extern float filterDeltaSmoothed;
+extern float lockDeltaSmoothed;
+extern float dampDeltaSmoothed;
+extern float weightDeltaSmoothed;
+
+float runFilterChain(long raw, FilterStep &step);
+
+float getTrimmedMean(long);
+float advancedFilteredADC(float);
+float getVibrationFilteredADC(float);
+float getLockedADC(float);
+float ADC2Weight(float);
+
+#endif
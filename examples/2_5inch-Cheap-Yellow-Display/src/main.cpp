@@ -2,86 +2,100 @@
 #include "micro_ui.h"
 #include <FS.h>
 #include <LITTLEFS.h>
-#include <SoftwareSerial.h>
 #include <algorithm> // Required for std::fill()
 #include <vector> // 
+#include "record_store.h"
+#include "loadcell_filter.h"
 #include "loadcell_receiver.h"
+#include "hc12_uart.h"
+#include "telemetry.h"
 
 //#define FORMAT_FLASH
-#define DEBUG_COUNT 300
-//#define DEBUG_FILTER
-//#define DEBUG_LOCK
 
-// ===== Callbacks =====
-void sliderMeanCallback(int value) {
-    Serial.print("Slider Mean value: ");
-    Serial.println(value);
-    config.meanSlider = value;
-}
-
-void sliderFilterCallback(int value) {
-    Serial.print("Slider Filter value: ");
-    Serial.println(value);
-    config.filterSlider = value;
-}
-
-void sliderVibrationCallback(int value) {
-    Serial.print("Slider Vibration value: ");
-    Serial.println(value);
-    config.vibrationSlider = value;
-}
-
-void sliderLockingCallback(int value) {
-    Serial.print("Slider Lock value: ");
-    Serial.println(value);
-    config.lockingSlider = value;
-}
+// Debug output goes out as binary telemetry records rather than text;
+// decode it on the host with tools/telemetry_decode.py.
+#if SHOW_ADC || defined(DEBUG_FILTER) || defined(DEBUG_LOCK)
+#define TELEMETRY
+#endif
 
-void numberPadCallback(const char *label) {
-    Serial.print("SliderA value: ");
-    Serial.println(label);
-}
+// ===== Callbacks =====
+// The filter sliders share one callback; the id indexes this table.
+static const char* const sliderNames[] = { "Mean", "Filter", "Vibration", "Lock" };
+
+void sliderCallback(const UIEvent &event, void *context) {
+    Serial.print("Slider ");
+    Serial.print(sliderNames[event.id]);
+    Serial.print(" value: ");
+    Serial.println(event.value);
+}
+
+// calStore is saved from both the settings task and the loop; the lock
+// keeps its sequence, active slot and file writes from interleaving.
+// Created on first use so the boot-time saves can take it too.
+static SemaphoreHandle_t calStoreLock() {
+    static SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+    return lock;
+}
+
+// Runs on the micro_ui settings task once the sliders have been left
+// alone for a moment, or when the screen changes.
+bool commitSettings(uint32_t dirtyMask) {
+    CalibrationData snapshot;
+    settingsSnapshot(&snapshot, &config, sizeof(CalibrationData));
+    xSemaphoreTake(calStoreLock(), portMAX_DELAY);
+    bool ok = recordStoreSave(calStore, &snapshot, sizeof(CalibrationData));
+    xSemaphoreGive(calStoreLock());
+    return ok;
+}
+
+// Every button on every screen comes here; the id says which.
+void buttonCallback(const UIEvent &event, void *context) {
+    if (event.id >= BUTTON_DIGIT) {
+        Serial.print("Number pad: ");
+        Serial.println(event.id - BUTTON_DIGIT);
+        return;
+    }
 
-void mainButtonsCallback(const char* label) {
-    if (strcmp(label, "ZERO") == 0) {
+    switch (event.id) {
+    case BUTTON_ZERO:
         Serial.println("Zero pressed");
-    } else if (strcmp(label, "Clear") == 0) {
+        break;
+    case BUTTON_CLEAR:
         Serial.println("Clear pressed");
-    } else if (strcmp(label, "ADD") == 0) {
+        break;
+    case BUTTON_ADD:
         Serial.println("Add pressed");
-    } else if (strcmp(label, "MENU") == 0) {
+        break;
+    case BUTTON_MENU:
         Serial.println("MENU pressed");
-        menuScreen();
-    }
-}
-
-void menuButtonsCallback(const char* label) {
-    if (strcmp(label, "BACK") == 0) {
+        showScreen(menuScreen, TRANSITION_SLIDE_LEFT);
+        break;
+    case BUTTON_BACK:
         Serial.println("Back pressed");
-        frontScreen();
-    } else if (strcmp(label, "FILTERS") == 0) {
+        showScreen(frontScreen, TRANSITION_SLIDE_RIGHT);
+        break;
+    case BUTTON_FILTERS:
         Serial.println("Filters pressed");
-        filterScreen();
-    } else if (strcmp(label, "CALIBRATION") == 0) {
+        showScreen(filterScreen, TRANSITION_SLIDE_LEFT);
+        break;
+    case BUTTON_CALIBRATION:
         Serial.println("Calibration pressed");
-    } else if (strcmp(label, "OTHER") == 0) {
+        break;
+    case BUTTON_OTHER:
         Serial.println("Other pressed");
-    }
-}
-
-void nextButtonsCallback(const char* label) {
-    if (strcmp(label, ">") == 0) {
+        break;
+    case BUTTON_NEXT:
         Serial.println("> pressed");
-        if(screen_num == FILTERS_SCREEN) {
-
-            return;
+        if (screen_num == FILTERS_SCREEN) {
+            showScreen(trendScreen, TRANSITION_SLIDE_LEFT);
+        } else if (screen_num == TREND_SCREEN) {
+            showScreen(filterScreen, TRANSITION_SLIDE_RIGHT);
         }
-    }
-    
-    if (strcmp(label, "X") == 0) {
+        break;
+    case BUTTON_CLOSE:
         Serial.println("X pressed");
-        frontScreen();
-        return;
+        showScreen(frontScreen, TRANSITION_WIPE_DOWN);
+        break;
     }
 }
 
@@ -110,14 +124,34 @@ void filterScreen() {
     createFilterButtons();
 }
 
+// Raw, filtered and locked ADC counts as they settle.
+void trendScreen() {
+    screen_num = TREND_SCREEN;
+    clearScreen();
+    createNextButtons();
+    drawAllButtons();
+
+    long margin = (config.fso_raw - config.zero_raw) / 50;
+    trendChart = addChart(0, 56, SCREEN_WIDTH, SCREEN_HEIGHT-56, 3, config.zero_raw - margin, config.fso_raw + margin);
+    drawAllCharts();
+
+    drawText(100, 8,  "RAW"   , 2, TFT_LIGHTGREY);
+    drawText(140, 8,  "FILTER", 2, TFT_GREEN);
+    drawText(100, 28, "LOCK"  , 2, TFT_YELLOW);
+}
+
 // ===== Setup and Loop =====
 void setup() {
     Serial.begin(115200);
     delay(1);
 	Serial.println("\n\nStarting");
     microUIInit();
+#ifdef TELEMETRY
+    telemetryBegin();
+#endif
     setupHC12();
     setupFS();
+    setupSettings();
     frontScreen();
     updateWeight(true);
 }
@@ -125,78 +159,25 @@ void setup() {
 int i=0;
 void loop() {
     microUILoopHandler();
-    checkHC12();
+    if (hc12ConfigService()) {
+        checkHC12();
+    }
 }
 
 void checkHC12() {
-    while (hc12.available()) {
-        char c = hc12.read();  
+    // Drain whatever the UART reader task has queued, once per loop.
+    static uint8_t rx[128];
+    HC12Batch batch = hc12Read(HC12Span{rx, sizeof(rx)});
+
+    for (size_t n = 0; n < batch.len; n++) {
+        char c = rx[n];
     
         if (c == '\n') {  
             hc_buf[bindex] = '\0';  
             if (bindex > 0) {  
-                static float filteredValue      = 0;
-                static float meanDelta          = 0;
-                static float filterDelta        = 0;
-                static float dampDelta          = 0;
-                static float lockDelta          = 0;
-                static float weightDelta        = 0;
-                filteredValue = atol(hc_buf);
-
-                const float deltaSmoothFactor = 0.1f;  // Lower = more smoothing
-
-                // TRIMMED MEAN STAGE
-                {
-                    // Use a static variable to store the previous cycle's output.
-                    static float lastTrimmed = filteredValue;
-                    float trimmed = getTrimmedMean(filteredValue);
-                    meanDelta = abs(trimmed - lastTrimmed);
-                    meanDeltaSmoothed += (meanDelta - meanDeltaSmoothed) * deltaSmoothFactor;
-                    lastTrimmed = trimmed;        // update stored output for next cycle
-                    filteredValue = trimmed;        // pass stage output on
-                }
-                
-                // ADVANCED FILTER STAGE
-                {
-                    static float lastAdvanced = filteredValue;
-                    float advanced = advancedFilteredADC(filteredValue);
-                    filterDelta = abs(advanced - lastAdvanced);
-                    filterDeltaSmoothed += (filterDelta - filterDeltaSmoothed) * deltaSmoothFactor;
-                    lastAdvanced = advanced;
-                    filteredValue = advanced;
-                }
-                
-                // VIBRATION FILTER STAGE
-                {
-                    static float lastVibration = filteredValue;
-                    float vibration = getVibrationFilteredADC(filteredValue);
-                    dampDelta = abs(vibration - lastVibration);
-                    dampDeltaSmoothed += (dampDelta - dampDeltaSmoothed) * deltaSmoothFactor;
-                    lastVibration = vibration;
-                    filteredValue = vibration;
-                }
-                
-                // LOCK FILTER STAGE
-                {
-                    static float lastLocked = filteredValue;
-                    float locked = getLockedADC(filteredValue);
-                    lockDelta = abs(locked - lastLocked);
-                    lockDeltaSmoothed += (lockDelta - lockDeltaSmoothed) * deltaSmoothFactor;
-                    lastLocked = locked;
-                    filteredValue = locked;
-                }
-                
-                // FINAL STAGE: CONVERT TO WEIGHT
-                {
-                    static float lastWeightOutput = filteredValue;
-                    weight = ADC2Weight(filteredValue);
-                    weightDelta = abs(weight - lastWeightOutput);
-                    weightDeltaSmoothed += (weightDelta - weightDeltaSmoothed) * deltaSmoothFactor;
-                    lastWeightOutput = weight;
-                }
-                                
-                float scale_factor = pow(10, config.dp+1); 
-                weight = round(weight * scale_factor) / scale_factor;
+                FilterStep step;
+                rawADC = atol(hc_buf);
+                weight = runFilterChain(rawADC, step);
 
                 updateStability();
 
@@ -204,26 +185,22 @@ void checkHC12() {
                 weight_counter++;
                 
                 if(SHOW_ADC) {
-                  Serial.print("Raw ADC: ");
-                  Serial.print(rawADC);
-                  Serial.print(" | Smoothed ADC: ");
-                  Serial.print(smoothedADC);
-                  Serial.print(" | Weight: ");
-                  Serial.print(weight);
-                  Serial.print(" | Weight (kg): ");
-                  Serial.println(weight, 2);
+                  telemetrySample(rawADC, step.out, step.delta, batch.lastUs);
                 }
     
                 if(screen_num == FRONT_SCREEN) {
                   updateWeight();
                 } else if(screen_num == FILTERS_SCREEN) {
                   updateLabel(filterWeightLabel, floatToStr(weight, config.dp));
-                  updateLabel(weightDeltaLabel, floatToStr(weightDelta, config.dp+1));
-
-                  updateLabel(meanDeltaLabel, floatToStr(meanDelta, 0));
-                  updateLabel(filterDeltaLabel, floatToStr(filterDelta, 0));
-                  updateLabel(lockDeltaLabel, floatToStr(lockDelta, 0));
-                  updateLabel(dampDeltaLabel, floatToStr(dampDelta, 0));
+                  updateLabel(weightDeltaLabel, floatToStr(step.delta[STAGE_WEIGHT], config.dp+1));
+
+                  updateLabel(meanDeltaLabel, floatToStr(step.delta[STAGE_MEAN], 0));
+                  updateLabel(filterDeltaLabel, floatToStr(step.delta[STAGE_FILTER], 0));
+                  updateLabel(lockDeltaLabel, floatToStr(step.delta[STAGE_LOCK], 0));
+                  updateLabel(dampDeltaLabel, floatToStr(step.delta[STAGE_DAMP], 0));
+                } else if(screen_num == TREND_SCREEN) {
+                  float trend[3] = { (float)rawADC, step.out[STAGE_FILTER], step.out[STAGE_LOCK] };
+                  chartPush(trendChart, trend);
                 }
             } else {
     //                Serial.println("Miss");
@@ -247,38 +224,62 @@ void saveCalDataDisplay() {
   }
   
 bool saveCalibrationData() {
-    File file = LITTLEFS.open(CONFIG_FN, "w");
-    if (!file) {
-      Serial.println("Failed to open file for writing");
+    xSemaphoreTake(calStoreLock(), portMAX_DELAY);
+    bool ok = recordStoreSave(calStore, &config, sizeof(CalibrationData));
+    uint32_t sequence = calStore.sequence;
+    int8_t slot = calStore.activeSlot;
+    xSemaphoreGive(calStoreLock());
+
+    if (!ok) {
+      Serial.println("Failed to save calibration record");
       return false;
     }
-  
-    size_t written = file.write((uint8_t *)&config, sizeof(CalibrationData));
-    file.close();
-    
-    Serial.println("Saved Calibration bytes " + String(sizeof(CalibrationData)));
-  
-    return written == sizeof(CalibrationData);  // Ensure function always returns a value
+
+    Serial.println("Saved Calibration record " + String(sequence) + " to slot " + String(slot));
+    return true;
 }
-  
-bool loadCalibrationData() {
+
+// Import the pre-versioned raw dump once, then retire it.
+static bool loadLegacyCalibrationData() {
     if (!LITTLEFS.exists(CONFIG_FN)) {
       return false;
     }
-  
+
     File file = LITTLEFS.open(CONFIG_FN, "r");
     if (!file) {
-      Serial.println("Failed to open file for reading");
       return false;
     }
-  
-    size_t read = file.read((uint8_t *)&config, sizeof(CalibrationData));
+
+    CalibrationData legacy;
+    bool ok = file.size() == sizeof(CalibrationData)
+           && file.read((uint8_t *)&legacy, sizeof(CalibrationData)) == sizeof(CalibrationData);
     file.close();
-  
-    return read == sizeof(CalibrationData);
-  }
+    if (!ok) {
+      return false;
+    }
+
+    config = legacy;
+    if (saveCalibrationData()) {
+      LITTLEFS.remove(CONFIG_FN);
+    }
+    return true;
+}
+
+bool loadCalibrationData() {
+    if (recordStoreLoad(calStore, &config, sizeof(CalibrationData))) {
+      return true;
+    }
+    return loadLegacyCalibrationData();
+}
+
+void setupSettings() {
+    meanSetting      = addSetting(&config.meanSlider);
+    filterSetting    = addSetting(&config.filterSlider);
+    vibrationSetting = addSetting(&config.vibrationSlider);
+    lockingSetting   = addSetting(&config.lockingSlider);
+    settingsSetCommitCallback(commitSettings);
+}
 
-  
 void setupFS() {
 #ifdef FORMAT_FLASH
   LITTLEFS.format();
@@ -312,30 +313,20 @@ void setupFS() {
   Serial.println("lockingSlider   " + String(config.lockingSlider));
 }
 
-void readHC12Response() {
-    long timeout = millis() + 1000; // 1-second timeout
-    while (millis() < timeout) {
-        while (hc12.available()) {
-            char c = hc12.read();
-            Serial.write(c); // Print response to Serial Monitor
-        }
-    }
-}
-  
+// Radio settings applied at boot. Each command completes on its reply.
+static const HC12Command hc12Setup[] = {
+    { "AT+FU3", "OK+FU3" },     // Transmission mode FU3
+    { "AT+P1",  "OK+P1"  },     // Lowest transmit power
+    { "AT+RX",  "OK+RP"  },     // Dump parameters: FU, baud, channel, then power last
+};
+
 void setupHC12() {
-    drawCenteredText("ARLC-1 Connecting");
-    pinMode(HC12_SET, OUTPUT);
-    digitalWrite(HC12_SET, LOW);  // Enter AT command mode before begin() !
-    delay(100);
-    hc12.begin(9600);
-    delay(100);
-    hc12.println("AT+FU3");
-    readHC12Response();
-    hc12.println("AT+P1");
-    readHC12Response();
-    hc12.println("AT+RX");
-    readHC12Response();
-    digitalWrite(HC12_SET, HIGH); // Enter normal mode
+    // Enter AT command mode before begin() ! Runs alongside the first
+    // screen; loop() polls it to completion.
+    hc12ConfigBegin(HC12_SET, hc12Setup, sizeof(hc12Setup) / sizeof(hc12Setup[0]));
+    if (!hc12Begin(HC12_RX, HC12_TX, HC12_BAUD)) {
+        Serial.println("Failed to start HC-12 UART");
+    }
 }
 
 void updateWeight(bool force) {
@@ -382,237 +373,6 @@ char* floatToStr(float value, int precision) {
 }
 
 
-inline float constrainFloat(float val, float minVal, float maxVal) {
-    if (val < minVal) return minVal;
-    else if (val > maxVal) return maxVal;
-    else return val;
-}
-
-float getTrimmedMean(long filteredValue) {
-    if(config.meanSlider == 0) {
-        return filteredValue;
-    }
-
-    int maxSize = max(5, config.meanSlider);  // Minimum size to make trimming meaningful
-    meanBuffer.push_back(filteredValue);
-
-    // Keep buffer size in check
-    if (meanBuffer.size() > maxSize)
-        meanBuffer.erase(meanBuffer.begin());
-
-    // Create a sorted copy for trimmed processing
-    std::vector<float> sorted = meanBuffer;
-    std::sort(sorted.begin(), sorted.end());
-
-    // Calculate trim count (e.g., 10% on each side)
-    int trimCount = sorted.size() * 10 / 100;
-    trimCount = min(trimCount, (int)sorted.size() / 2);  // Avoid trimming too much
-
-    // Compute trimmed mean
-    float sum = 0;
-    int count = 0;
-    for (int i = trimCount; i < (int)sorted.size() - trimCount; ++i) {
-        sum += sorted[i];
-        count++;
-    }
-
-    return count > 0 ? sum / count : filteredValue;
-}
-
-float advancedFilteredADC(float input) {
-    static float output = 0;
-    static bool firstRun = true;
-    static unsigned long debugCount = 0;
-
-    // Handle filter disabled: no filtering at all.
-    if (config.filterSlider == 0) {
-        output = input;
-        firstRun = true;
-        return input;
-    }
-
-    // First-time setup: initialize output.
-    if (firstRun) {
-        output = input;
-        firstRun = false;
-        return output;
-    }
-
-    // Define working range
-    float range = std::max<float>(1.0f, config.fso_raw);
-    float safeMin = config.zero_raw - range * 0.5f;
-    float safeMax = config.zero_raw + range * 1.5f;
-
-    // Optional: ignore inputs way outside the expected bounds.
-    if (input < safeMin || input > safeMax) {
-#ifdef DEBUG_FILTER
-        if (debugCount < DEBUG_COUNT) {
-            Serial.printf("[ADV-FILTER %02d] INPUT OUT OF RANGE: in=%.2f, skipping\n", debugCount, input);
-        }
-#endif
-        return output;
-    }
-
-    // --- Invert the slider mapping ---
-    // Our new normalized value 'u' is defined so that u=1 when slider=1 (i.e. least filtering)
-    // and u=0 when slider=100 (i.e. best filtering).
-    float u = constrain((100.0f - config.filterSlider) / 99.0f, 0.0f, 1.0f);
-
-    // Map u nonlinearly for smoothing factor and step limit.
-    float alpha = u * u;  // When u=1 (slider at 1), alpha=1 (raw, no filtering). When u=0 (slider at 100), alpha=0.
-    float stepLimit = range * (0.001f + pow(u, 2.5f) * 0.05f);  // Higher u gives a higher allowable delta.
-
-    float delta = input - output;
-    bool stepOverride = false;
-
-    // If the absolute difference exceeds stepLimit, snap to the new input.
-    if (fabs(delta) > stepLimit) {
-        output = input;
-        stepOverride = true;
-    } else {
-        // Otherwise, update using exponential smoothing.
-        output += alpha * delta;
-    }
-
-#ifdef DEBUG_FILTER
-    if (debugCount < DEBUG_COUNT) {
-        Serial.printf("[ADV-FILTER %02lu] in=%.2f, out=%.2f, delta=%.2f, alpha=%.3f, stepLimit=%.1f%s\n",
-                      debugCount, input, output, delta, alpha, stepLimit,
-                      stepOverride ? "  [STEP OVERRIDE]" : "");
-        debugCount++;
-    }
-#endif
-
-    return output;
-}
-
-
-float getLockedADC(float filteredValue) {
-    static float lockedValue = 0;       // Committed lock value
-    static float visualOutput = 0;      // Smooth output
-    static float pendingValue = 0;      // Candidate for locking
-    static int lockCount = 0;           // Stability counter
-    static unsigned long debugCount = 0;
-
-    if (config.lockingSlider == 0) {
-        lockedValue = filteredValue;
-        visualOutput = filteredValue;
-        pendingValue = 0;
-        lockCount = 0;
-        return filteredValue;
-    }
-
-    float stabilityFactor = constrain(config.lockingSlider / 100.0f, 0.01f, 1.0f);
-
-    
-    // Full slider (100) = ~3s lock time at 25Hz update (i.e. 75 samples)
-    const int maxLockCount = 75; // ~3s at 25Hz
-    const int lockCountNeeded = 1 + (int)(stabilityFactor * (maxLockCount - 1));
-
-    const float flickerThreshold = (float)config.fso_raw / config.divisions * (1.0f + stabilityFactor * 1.5f);
-    const float easing = 0.01f + (1.0f - stabilityFactor) * 0.25f;
-
-    float deltaToLocked = fabs(filteredValue - lockedValue);
-    float deltaToPending = fabs(filteredValue - pendingValue);
-
-    const float unlockThreshold = flickerThreshold * 3.0f;  // Or tune this multiplier
-
-    if (fabs(filteredValue - lockedValue) > unlockThreshold) {
-        lockedValue = filteredValue;  // Or 0 if you want it to drop fast
-        pendingValue = 0;
-        lockCount = 0;
-#ifdef DEBUG_LOCK
-        if (debugCount < DEBUG_COUNT) {
-            Serial.println(" → FORCE UNLOCKED due to jump");
-        }
-#endif
-    }
-
-#ifdef DEBUG_LOCK
-    if (debugCount < DEBUG_COUNT) {
-        Serial.printf("getStableValue in %.5f | deltaToLock=%.2f | threshold=%.2f | easing=%.3f | lockCountNeeded=%d\n",
-                      filteredValue, deltaToLocked, flickerThreshold, easing, lockCountNeeded);
-    }
-#endif
-
-    if (deltaToLocked < flickerThreshold) {
-        pendingValue = 0;
-        lockCount = 0;
-    } else {
-        if (pendingValue == 0 || deltaToPending >= flickerThreshold) {
-            pendingValue = filteredValue;
-            lockCount = 1;
-        } else {
-            lockCount++;
-            if (lockCount >= lockCountNeeded) {
-                lockedValue = pendingValue;
-#ifdef DEBUG_LOCK
-                if (debugCount < DEBUG_COUNT) {
-                    Serial.println(" → LOCKED: " + String(lockedValue));
-                }
-#endif
-                pendingValue = 0;
-                lockCount = 0;
-            }
-        }
-    }
-
-    visualOutput = visualOutput * (1.0f - easing) + lockedValue * easing;
-
-#ifdef DEBUG_LOCK
-    if (debugCount++ < DEBUG_COUNT) {
-        Serial.println(" → DISPLAYING: " + String(visualOutput));
-    }
-#endif
-
-    return visualOutput;
-}
-
-float getVibrationFilteredADC(float filteredValue) {
-    static float vibDisplay = 0;
-    static float vibHistory[6] = {0};
-    static int vibIndex = 0;
-
-    if(config.vibrationSlider == 0) {
-        return filteredValue;
-    }
-    // Convert slider to float (0.0 to 1.0)
-    float vibrationFiltering = (float)config.vibrationSlider / 100.0f;
-    if (vibrationFiltering < 0.0f) vibrationFiltering = 0.0f;
-    if (vibrationFiltering > 1.0f) vibrationFiltering = 1.0f;
-
-    // Damping control: higher damping at low slider values
-    float smoothness = 1.0f - vibrationFiltering;  // 1 = max damping
-    float dampingAlpha = 0.01f + (smoothness * 0.29f);  // Range: 0.01 – 0.30
-
-    // IIR smoothing
-    vibDisplay = dampingAlpha * filteredValue + (1.0f - dampingAlpha) * vibDisplay;
-
-    // Cadence rejection using moving average
-    float movingAvg = 0;
-    for (int i = 0; i < 6; i++) movingAvg += vibHistory[i];
-    movingAvg /= 6.0f;
-
-    vibHistory[vibIndex++] = vibDisplay;
-    if (vibIndex >= 6) vibIndex = 0;
-
-    // If filtering is aggressive and variation is subtle, freeze at average
-    if (vibrationFiltering > 0.8f && fabs(vibDisplay - movingAvg) < 0.002f) {
-        vibDisplay = movingAvg;
-    }
-
-    return vibDisplay;
-}
-
-float ADC2Weight(float filteredValue) {
-    float weight_kg = 0.0;
-    if (config.fso_raw != config.zero_raw) { 
-        weight_kg = round(((float)(filteredValue - config.zero_raw) / (float)(config.fso_raw - config.zero_raw)) * config.divisions) * ((float)config.capacity / (float)config.divisions);
-    }
-    return weight_kg;
-}
-
-
 void updateStability() {
     if(isVeryStable == isStable) return;
     isVeryStable = isStable;
@@ -651,17 +411,17 @@ void createNumberPad() {
     for (int i = 0; i < numButtonsPerRow; i++) {
         int x = hMargin + i * (buttonWidth + gap);
         addButton(x, row1_y, buttonWidth, buttonHeight,
-            row1Labels[i],
-            numberPadCallback, 4, TFT_BLUE, TFT_BLACK);
+            row1Labels[i], BUTTON_DIGIT + atoi(row1Labels[i]),
+            buttonCallback, nullptr, 4, TFT_BLUE, TFT_BLACK);
         addButton(x, row2_y, buttonWidth, buttonHeight,
-            row2Labels[i],
-            numberPadCallback, 4, TFT_BLUE, TFT_BLACK);
+            row2Labels[i], BUTTON_DIGIT + atoi(row2Labels[i]),
+            buttonCallback, nullptr, 4, TFT_BLUE, TFT_BLACK);
     }
 }
 
 void createNextButtons() {
-    addButton(SCREEN_WIDTH-(SCREEN_WIDTH/5)-20, 0, SCREEN_WIDTH/5+20, 50, ">", nextButtonsCallback, 4, TFT_GREEN, TFT_BLACK);
-    addButton(0, 0, SCREEN_WIDTH/5 + 20, 50, "X", nextButtonsCallback, 4, TFT_RED, TFT_BLACK);
+    addButton(SCREEN_WIDTH-(SCREEN_WIDTH/5)-20, 0, SCREEN_WIDTH/5+20, 50, ">", BUTTON_NEXT, buttonCallback, nullptr, 4, TFT_GREEN, TFT_BLACK);
+    addButton(0, 0, SCREEN_WIDTH/5 + 20, 50, "X", BUTTON_CLOSE, buttonCallback, nullptr, 4, TFT_RED, TFT_BLACK);
 }
 
 void createMainButtons() {
@@ -674,16 +434,16 @@ void createMainButtons() {
     int y = SCREEN_HEIGHT - buttonHeight - 5;
 
     int x = padding;
-    addButton(x, y, buttonWidth, buttonHeight, "ZERO", mainButtonsCallback, 4);
+    addButton(x, y, buttonWidth, buttonHeight, "ZERO", BUTTON_ZERO, buttonCallback, nullptr, 4);
 
     x += buttonWidth + padding;
-    addButton(x, y, buttonWidth, buttonHeight, "CLR", mainButtonsCallback, 4, TFT_DARKGREY);
+    addButton(x, y, buttonWidth, buttonHeight, "CLR", BUTTON_CLEAR, buttonCallback, nullptr, 4, TFT_DARKGREY);
 
     x += buttonWidth + padding;
-    addButton(x, y, buttonWidth, buttonHeight, "ADD", mainButtonsCallback, 4, TFT_DARKGREY);
+    addButton(x, y, buttonWidth, buttonHeight, "ADD", BUTTON_ADD, buttonCallback, nullptr, 4, TFT_DARKGREY);
 
     x += buttonWidth + padding;
-    addButton(x, y, buttonWidth, buttonHeight, "MENU", mainButtonsCallback, 4);
+    addButton(x, y, buttonWidth, buttonHeight, "MENU", BUTTON_MENU, buttonCallback, nullptr, 4);
 }
 
 void createMenuButtons() {
@@ -700,14 +460,14 @@ void createMenuButtons() {
     int x = padding;
     int y = padding;
 
-    addButton(x, y, buttonWidth, buttonHeight, "BACK", menuButtonsCallback, 4);
+    addButton(x, y, buttonWidth, buttonHeight, "BACK", BUTTON_BACK, buttonCallback, nullptr, 4);
     x += buttonWidth + padding;
-    addButton(x, y, buttonWidth, buttonHeight, "FILTERS", menuButtonsCallback, 4);
+    addButton(x, y, buttonWidth, buttonHeight, "FILTERS", BUTTON_FILTERS, buttonCallback, nullptr, 4);
     x = padding;
     y += buttonHeight + padding;
-    addButton(x, y, buttonWidth, buttonHeight, "CALIBRATION", menuButtonsCallback, 4);
+    addButton(x, y, buttonWidth, buttonHeight, "CALIBRATION", BUTTON_CALIBRATION, buttonCallback, nullptr, 4);
     x += buttonWidth + padding;
-    addButton(x, y, buttonWidth, buttonHeight, "OTHER", menuButtonsCallback, 4);
+    addButton(x, y, buttonWidth, buttonHeight, "OTHER", BUTTON_OTHER, buttonCallback, nullptr, 4);
 
     drawAllButtons();
 
@@ -717,10 +477,11 @@ void createFilterButtons() {
     createNextButtons();
     drawAllButtons();
 
-    addSlider(5, 50,  SCREEN_WIDTH-76, 50, config.meanSlider,       sliderMeanCallback, TFT_GREEN, TFT_BLUE, TFT_BLACK);   
-    addSlider(5, 100, SCREEN_WIDTH-76, 50, config.filterSlider,     sliderFilterCallback, TFT_GREEN, TFT_BLUE, TFT_BLACK);
-    addSlider(5, 150, SCREEN_WIDTH-76, 50, config.vibrationSlider,  sliderVibrationCallback, TFT_GREEN, TFT_BLUE, TFT_BLACK);
-    addSlider(5, 200, SCREEN_WIDTH-76, 50, config.lockingSlider,    sliderLockingCallback, TFT_GREEN, TFT_BLUE, TFT_BLACK);
+    // Bound sliders write their setting while dragging; it is saved later.
+    bindSliderSetting(addSlider(5, 50,  SCREEN_WIDTH-76, 50, config.meanSlider, 0, sliderCallback, nullptr, TFT_GREEN, TFT_BLUE, TFT_BLACK), meanSetting);
+    bindSliderSetting(addSlider(5, 100, SCREEN_WIDTH-76, 50, config.filterSlider, 1, sliderCallback, nullptr, TFT_GREEN, TFT_BLUE, TFT_BLACK), filterSetting);
+    bindSliderSetting(addSlider(5, 150, SCREEN_WIDTH-76, 50, config.vibrationSlider, 2, sliderCallback, nullptr, TFT_GREEN, TFT_BLUE, TFT_BLACK), vibrationSetting);
+    bindSliderSetting(addSlider(5, 200, SCREEN_WIDTH-76, 50, config.lockingSlider, 3, sliderCallback, nullptr, TFT_GREEN, TFT_BLUE, TFT_BLACK), lockingSetting);
     drawAllSliders();
 
     drawTriangleWithBorder(95, 30, 18, 18, 3, TFT_BLACK, TFT_YELLOW);
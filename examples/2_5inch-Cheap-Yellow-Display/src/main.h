@@ -3,15 +3,16 @@ using fs::File;
 #define SHOW_ADC false
 #define HIDE_WIFI true
 
-#define CONFIG_FN "/calibration.dat"
+#define CONFIG_FN "/calibration.dat"    // Legacy raw dump, migrated on boot
+#define CAL_SLOT_A  "/cal_a.rec"
+#define CAL_SLOT_B  "/cal_b.rec"
+#define CAL_SCHEMA  1                   // Bump when CalibrationData grows
 
 #define HC12_RX     16
 #define HC12_TX     17
 #define HC12_BAUD   9600
 #define HC12_SET    4
 
-SoftwareSerial hc12(HC12_RX, HC12_TX);  // RX_ESP32, TX_ESP32
-
 String cal_entry    = "";
 float weight        = 0;
 float accu      = 0;
@@ -27,14 +28,6 @@ float smoothedADC = 0;
 float filteredADC = 0;
 float lockedADC = 0;
 float dampedADC = 0;
-std::vector<float> meanBuffer;
-
-float meanDeltaSmoothed   = 0;
-float filterDeltaSmoothed = 0;
-float lockDeltaSmoothed   = 0;
-float dampDeltaSmoothed   = 0;
-float weightDeltaSmoothed = 0;
-
 bool isStable = false;
 bool isVeryStable = false;
 
@@ -47,20 +40,6 @@ int  in_pos = 0;
 char cal_buf[64];
 int  cal_pos = 0;
 
-struct CalibrationData {
-    int capacity;        // capacity (kg)
-    int divisions;       // Number of discrete steps
-    int dp;              // 0 1 2 3
-    long zero_raw;       // gathered from getZero()
-    long cal_kg;         // entered from doCalibration()
-    long cal_raw;        // gathered from getCalibration()
-    long fso_raw;        // from calculateFSO()
-    int meanSlider;      // getTrimmedMean()
-    int filterSlider;    // advancedFilteredADC()
-    int vibrationSlider; // getVibrationFilteredADC()
-    int lockingSlider;   // getStableADC()
-};
-  
 CalibrationData config = {
     .capacity         = 1,        // 1kg load cell
     .divisions        = 3000,     // Targeting high precision
@@ -75,12 +54,15 @@ CalibrationData config = {
     .lockingSlider    = 50
 };
   
+RecordStore calStore = RECORD_STORE(CAL_SLOT_A, CAL_SLOT_B, CAL_SCHEMA);
+
 // int stepThreshold;    // 2 (sensitive)       to 20 (less reactive)
 // float alpha;          // 0.05 (slow filter)  to 0.5 (fast filter)
 // int maxBuffer;
 
 void setupHC12();
 void setupFS();
+void setupSettings();
 void updateStability();
 void checkHC12();
 bool saveCalibrationData();
@@ -89,15 +71,8 @@ bool loadCalibrationData();
 long calculateFSO(long zero_raw, long cal_raw, long cal_kg, int capacity);
 void updateWeight(bool force = true);
 
-void readHC12Response();
 char* floatToStr(float value, int precision = 2);
 
-float getTrimmedMean(long);
-float advancedFilteredADC(float);
-float getVibrationFilteredADC(float);
-float getLockedADC(float);
-float ADC2Weight(float);
-
 LabelHandle weightLabel, 
             accuLabel,
             filterWeightLabel,
@@ -107,6 +82,13 @@ LabelHandle weightLabel,
             dampDeltaLabel,
             weightDeltaLabel;
   
+ChartHandle trendChart;
+
+SettingHandle meanSetting,
+              filterSetting,
+              vibrationSetting,
+              lockingSetting;
+
 char row1Labels[5][2] = { "1", "2", "3", "4", "5" };
 char row2Labels[5][2] = { "6", "7", "8", "9", "0" };
 
@@ -118,8 +100,24 @@ void createFilterButtons();
 void frontScreen();
 void menuScreen();
 void filterScreen();
+void trendScreen();
 void calScreen1();
 
+// Button ids for buttonCallback(); number pad digits follow BUTTON_DIGIT.
+enum Buttons {
+  BUTTON_ZERO = 1,
+  BUTTON_CLEAR,
+  BUTTON_ADD,
+  BUTTON_MENU,
+  BUTTON_BACK,
+  BUTTON_FILTERS,
+  BUTTON_CALIBRATION,
+  BUTTON_OTHER,
+  BUTTON_NEXT,
+  BUTTON_CLOSE,
+  BUTTON_DIGIT
+};
+
 enum Screens {
   FRONT_SCREEN,
   MENU_SCREEN,
@@ -128,5 +126,6 @@ enum Screens {
   CAL_SCREEN2,
   CAL_SCREEN3,
   CAL_SCREEN4,
-  CAL_SCREEN5
+  CAL_SCREEN5,
+  TREND_SCREEN
 };
\ No newline at end of file
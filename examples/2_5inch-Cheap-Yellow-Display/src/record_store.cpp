@@ -0,0 +1,106 @@
+// Crash-safe A/B record store on LittleFS
+#include "record_store.h"
+#include <FS.h>
+#include <LITTLEFS.h>
+
+using fs::File;
+
+// Header fields covered by the CRC: schema, length and sequence.
+#define RECORD_CRC_FIELDS   (sizeof(uint16_t) * 2 + sizeof(uint32_t))
+
+uint32_t recordCrc32(const void* data, size_t len, uint32_t crc) {
+    const uint8_t* p = (const uint8_t*)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t headerCrc(const RecordHeader &hdr, const uint8_t* payload) {
+    uint32_t crc = recordCrc32(&hdr.schema, RECORD_CRC_FIELDS);
+    return recordCrc32(payload, hdr.length, crc);
+}
+
+// Read one slot into `payload`. Rejects torn writes, foreign files and
+// schemas newer than the store understands.
+static bool readSlot(const RecordStore &store, int slot, RecordHeader &hdr, uint8_t* payload, size_t len) {
+    if (!LITTLEFS.exists(store.slotPath[slot])) return false;
+
+    File file = LITTLEFS.open(store.slotPath[slot], "r");
+    if (!file) return false;
+
+    bool ok = file.read((uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr)
+        && hdr.magic == RECORD_MAGIC
+        && hdr.length <= RECORD_MAX_PAYLOAD
+        && hdr.schema <= store.schema
+        && (hdr.schema == store.schema ? hdr.length == len : hdr.length <= len)
+        && file.read(payload, hdr.length) == hdr.length
+        && headerCrc(hdr, payload) == hdr.crc;
+    file.close();
+    return ok;
+}
+
+bool recordStoreLoad(RecordStore &store, void* data, size_t len) {
+    if (!data || len > RECORD_MAX_PAYLOAD) return false;
+
+    uint8_t      payload[2][RECORD_MAX_PAYLOAD];
+    RecordHeader hdr[2];
+    bool         valid[2];
+    for (int slot = 0; slot < 2; slot++) {
+        valid[slot] = readSlot(store, slot, hdr[slot], payload[slot], len);
+    }
+
+    int best = -1;
+    if (valid[0] && valid[1]) {
+        best = (int32_t)(hdr[1].sequence - hdr[0].sequence) > 0 ? 1 : 0;
+    } else if (valid[0]) {
+        best = 0;
+    } else if (valid[1]) {
+        best = 1;
+    }
+    if (best < 0) return false;
+
+    memcpy(data, payload[best], hdr[best].length);
+    store.sequence   = hdr[best].sequence;
+    store.activeSlot = best;
+    // An older schema never matches, so the next save upgrades it.
+    store.payloadCrc = hdr[best].schema == store.schema ? recordCrc32(data, len) : 0;
+    return true;
+}
+
+bool recordStoreSave(RecordStore &store, const void* data, size_t len) {
+    if (!data || len > RECORD_MAX_PAYLOAD) return false;
+
+    uint32_t crc = recordCrc32(data, len);
+    if (store.activeSlot >= 0 && crc == store.payloadCrc) {
+        store.skipped++;
+        return true;
+    }
+
+    RecordHeader hdr;
+    hdr.magic    = RECORD_MAGIC;
+    hdr.schema   = store.schema;
+    hdr.length   = len;
+    hdr.sequence = store.sequence + 1;
+    hdr.crc      = headerCrc(hdr, (const uint8_t*)data);
+
+    // Never touch the slot holding the newest good record.
+    int slot = store.activeSlot == 0 ? 1 : 0;
+    File file = LITTLEFS.open(store.slotPath[slot], "w");
+    if (!file) return false;
+
+    size_t written = file.write((const uint8_t*)&hdr, sizeof(hdr));
+    written += file.write((const uint8_t*)data, len);
+    file.close();
+    if (written != sizeof(hdr) + len) return false;
+
+    store.sequence   = hdr.sequence;
+    store.activeSlot = slot;
+    store.payloadCrc = crc;
+    store.writes++;
+    return true;
+}
@@ -0,0 +1,54 @@
+/* Crash-safe record store on LittleFS.
+
+   A record is a small fixed struct written with a header carrying a
+   magic, schema version, payload length, sequence number and CRC32.
+   Two slot files (A/B) are used alternately: a save always overwrites
+   the slot that does NOT hold the newest valid record, so a power cut
+   mid-write leaves the previous record intact. Loading reads both
+   slots and keeps the valid one with the highest sequence.
+
+   Saves whose payload CRC matches the newest record are skipped to
+   spare the flash. Batching rapid changes is left to the caller; the
+   CYD example saves from the micro_ui settings task.
+
+   Schema upgrades append fields: a record with an older schema and a
+   shorter payload loads into the front of the struct and leaves the
+   new tail at whatever defaults the caller put there.
+*/
+
+#ifndef RECORD_STORE_H
+#define RECORD_STORE_H
+
+#include <Arduino.h>
+
+#define RECORD_MAGIC            0x43524C41UL    // "ALRC"
+#define RECORD_MAX_PAYLOAD      256
+
+struct RecordHeader {
+    uint32_t magic;
+    uint16_t schema;
+    uint16_t length;        // Payload bytes following the header
+    uint32_t sequence;      // Incremented on every save
+    uint32_t crc;           // CRC32 over schema, length, sequence and payload
+};
+
+struct RecordStore {
+    const char*     slotPath[2];
+    uint16_t        schema;
+
+    uint32_t        sequence;       // Sequence of the newest valid record
+    int8_t          activeSlot;     // Slot holding it, -1 if none
+    uint32_t        payloadCrc;     // CRC of its payload
+
+    uint32_t        writes;         // Saves that reached the flash
+    uint32_t        skipped;        // Saves skipped as unchanged
+};
+
+#define RECORD_STORE(pathA, pathB, schemaVersion) \
+    RecordStore{ { pathA, pathB }, schemaVersion, 0, -1, 0, 0, 0 }
+
+bool     recordStoreLoad(RecordStore &store, void* data, size_t len);
+bool     recordStoreSave(RecordStore &store, const void* data, size_t len);
+uint32_t recordCrc32(const void* data, size_t len, uint32_t crc = 0);
+
+#endif
@@ -0,0 +1,98 @@
+// Lock-free binary telemetry drained to Serial by a background task
+#include "telemetry.h"
+#include <atomic>
+
+static_assert((TELEM_RECORDS & (TELEM_RECORDS - 1)) == 0, "TELEM_RECORDS must be a power of two");
+
+static TelemetryRecord          records[TELEM_RECORDS];
+static std::atomic<uint32_t>    recHead(0);     // Written by the loop
+static std::atomic<uint32_t>    recTail(0);     // Written by the drain task
+static uint16_t                 recSeq          = 0;
+static uint16_t                 recDropped      = 0;
+static uint32_t                 totalDropped    = 0;
+static TaskHandle_t             drainTask       = nullptr;
+
+static uint16_t fletcher16(const uint8_t* data, size_t len) {
+    uint16_t a = 0, b = 0;
+    while (len--) {
+        a = (a + *data++) % 255;
+        b = (b + a) % 255;
+    }
+    return (b << 8) | a;
+}
+
+// Claim the next free slot, or count a drop when the drain is behind.
+static TelemetryRecord* claim(TelemetryType type) {
+    if (!drainTask) return nullptr;
+
+    uint32_t head = recHead.load(std::memory_order_relaxed);
+    if (head - recTail.load(std::memory_order_acquire) >= TELEM_RECORDS) {
+        recDropped++;
+        totalDropped++;
+        return nullptr;
+    }
+
+    TelemetryRecord* rec = &records[head & (TELEM_RECORDS - 1)];
+    rec->sync = TELEM_SYNC;
+    rec->type = type;
+    rec->seq = recSeq++;
+    rec->us = micros();
+    rec->rxUs = 0;
+    return rec;
+}
+
+static void publish(TelemetryRecord* rec) {
+    rec->dropped = recDropped;
+    recDropped = 0;
+    rec->check = fletcher16((const uint8_t*)rec, sizeof(TelemetryRecord) - sizeof(rec->check));
+    recHead.store(recHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+static void telemetryDrain(void*) {
+    for (;;) {
+        uint32_t tail = recTail.load(std::memory_order_relaxed);
+        uint32_t head = recHead.load(std::memory_order_acquire);
+        if (head == tail) {
+            vTaskDelay(pdMS_TO_TICKS(TELEM_IDLE_MS));
+            continue;
+        }
+
+        // Write the contiguous run in one call; the slots stay owned by
+        // this task until the tail moves past them.
+        uint32_t offset = tail & (TELEM_RECORDS - 1);
+        uint32_t count = min(head - tail, (uint32_t)(TELEM_RECORDS - offset));
+        Serial.write((const uint8_t*)&records[offset], count * sizeof(TelemetryRecord));
+        recTail.store(tail + count, std::memory_order_release);
+    }
+}
+
+bool telemetryBegin() {
+    if (drainTask) return true;
+    return xTaskCreate(telemetryDrain, "telemetry", TELEM_TASK_STACK, nullptr, TELEM_TASK_PRIORITY, &drainTask) == pdPASS;
+}
+
+void telemetrySample(int32_t raw, const float* stages, const float* deltas, uint32_t rxUs) {
+    TelemetryRecord* rec = claim(TELEM_SAMPLE);
+    if (!rec) return;
+    rec->rxUs = rxUs;
+    rec->raw = raw;
+    for (int i = 0; i < TELEM_STAGES; i++) {
+        rec->value[i] = stages[i];
+        rec->value[TELEM_STAGES + i] = deltas[i];
+    }
+    publish(rec);
+}
+
+void telemetryEvent(TelemetryType type, int32_t code, const float* values, uint8_t count) {
+    TelemetryRecord* rec = claim(type);
+    if (!rec) return;
+    rec->raw = code;
+    for (int i = 0; i < TELEM_VALUES; i++) {
+        rec->value[i] = i < count ? values[i] : 0.0f;
+    }
+    publish(rec);
+}
+
+uint32_t telemetryDropped() {
+    return totalDropped;
+}
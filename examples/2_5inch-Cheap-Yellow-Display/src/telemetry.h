@@ -0,0 +1,53 @@
+/* Binary telemetry for the filter chain.
+
+   Fixed-size records are queued into a lock-free single-producer/
+   single-consumer ring from the loop and written to Serial by a
+   low-priority task, so tracing costs a few stores instead of a
+   blocking printf. When the ring is full new records are dropped and
+   counted; the next record carries the count.
+
+   Every record starts with TELEM_SYNC and ends with a Fletcher-16
+   check, so the host decoder (tools/telemetry_decode.py) can resync
+   around any text that is still printed to the same port.
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+#define TELEM_SYNC          0xA5
+#define TELEM_VALUES        10
+#define TELEM_RECORDS       64      // Ring capacity, must be a power of two
+#define TELEM_TASK_STACK    2048
+#define TELEM_TASK_PRIORITY 1       // Below the Arduino loop task
+#define TELEM_IDLE_MS       10      // Sleep when the ring is empty
+
+enum TelemetryType : uint8_t {
+    TELEM_SAMPLE    = 1,    // value[0..4] stage outputs, value[5..9] stage deltas
+    TELEM_FILTER    = 2,    // advancedFilteredADC() step, see main.cpp
+    TELEM_LOCK      = 3,    // getLockedADC() step, see main.cpp
+};
+
+#define TELEM_STAGES        5       // Stage order follows FilterStage in loadcell_filter.h
+
+struct __attribute__((packed)) TelemetryRecord {
+    uint8_t  sync;                  // TELEM_SYNC
+    uint8_t  type;                  // TelemetryType
+    uint16_t seq;                   // Increments per queued record
+    uint32_t us;                    // micros() when queued
+    uint32_t rxUs;                  // micros() when the source bytes arrived, 0 if n/a
+    int32_t  raw;                   // Raw ADC reading or event code
+    float    value[TELEM_VALUES];
+    uint16_t dropped;               // Records dropped just before this one
+    uint16_t check;                 // Fletcher-16 over all preceding bytes
+};
+
+static_assert(sizeof(TelemetryRecord) == 60, "TelemetryRecord layout is shared with the host decoder");
+
+bool telemetryBegin();
+void telemetrySample(int32_t raw, const float* stages, const float* deltas, uint32_t rxUs);
+void telemetryEvent(TelemetryType type, int32_t code, const float* values, uint8_t count);
+uint32_t telemetryDropped();
+
+#endif
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Decode the binary telemetry stream from src/telemetry.h into CSV.
+
+Reads a capture file (or stdin, or a serial port with --port) and
+writes one CSV per record type. Text printed on the same port is
+skipped: records are found by their sync byte and Fletcher-16 check.
+
+    python telemetry_decode.py capture.bin -o out
+    python telemetry_decode.py --port COM13 --baud 115200 -o out
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+SYNC = 0xA5
+RECORD = struct.Struct("<BBHIIi10fHH")   # Must match TelemetryRecord
+assert RECORD.size == 60
+
+STAGES = ["mean", "filter", "damp", "lock", "weight"]
+
+TYPES = {
+    1: ("samples", ["raw"] + [s + "_out" for s in STAGES] + [s + "_delta" for s in STAGES]),
+    2: ("filter", ["event", "in", "out", "delta", "alpha", "step_limit"]),
+    3: ("lock", ["events", "in", "delta_to_locked", "threshold", "easing",
+                 "lock_count_needed", "lock_count", "locked", "display"]),
+}
+
+
+def fletcher16(data):
+    a = b = 0
+    for byte in data:
+        a = (a + byte) % 255
+        b = (b + a) % 255
+    return (b << 8) | a
+
+
+def records(stream):
+    """Yield decoded record tuples, resyncing on corrupt or foreign bytes."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            return
+        buf += chunk
+        while len(buf) >= RECORD.size:
+            if buf[0] != SYNC or buf[1] not in TYPES:
+                del buf[0]
+                continue
+            raw = bytes(buf[:RECORD.size])
+            fields = RECORD.unpack(raw)
+            if fletcher16(raw[:-2]) != fields[-1]:
+                del buf[0]
+                continue
+            del buf[:RECORD.size]
+            yield fields
+
+
+def open_input(args):
+    if args.port:
+        import serial  # pyserial, only needed for live capture
+        return serial.Serial(args.port, args.baud, timeout=1)
+    if args.input in (None, "-"):
+        return sys.stdin.buffer
+    return open(args.input, "rb")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", help="capture file, '-' for stdin")
+    parser.add_argument("--port", help="read live from a serial port instead")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("-o", "--out", default=".", help="output directory for the CSV files")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    writers, files = {}, []
+    for kind, (name, columns) in TYPES.items():
+        f = open(os.path.join(args.out, name + ".csv"), "w", newline="")
+        files.append(f)
+        writers[kind] = csv.writer(f)
+        writers[kind].writerow(["seq", "us", "rx_us", "dropped"] + columns)
+
+    counts = dict.fromkeys(TYPES, 0)
+    last_seq, gaps = None, 0
+    try:
+        for _, kind, seq, us, rx_us, raw, *rest in records(open_input(args)):
+            values, dropped = rest[:10], rest[10]
+            if last_seq is not None and seq != (last_seq + 1) & 0xFFFF:
+                gaps += 1
+            last_seq = seq
+            width = len(TYPES[kind][1]) - 1
+            writers[kind].writerow([seq, us, rx_us, dropped, raw] + ["%.6g" % v for v in values[:width]])
+            counts[kind] += 1
+    except KeyboardInterrupt:
+        pass
+    finally:
+        for f in files:
+            f.close()
+
+    summary = ", ".join("%s=%d" % (TYPES[k][0], n) for k, n in counts.items())
+    print("%s, sequence gaps=%d" % (summary, gaps), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
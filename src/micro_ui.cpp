@@ -1,519 +1,2755 @@
 // Micro UI library for TFT displays with touch support
 #include "micro_ui.h"
+#include <new>
 
 TFT_eSPI tft = TFT_eSPI();  // TFT_eSPI uses pins defined in User_Setup.h
 SPIClass touchscreenSPI = SPIClass(VSPI);
 XPT2046_Touchscreen touchscreen(XPT2046_CS, XPT2046_IRQ);
 
-unsigned long   touchStartTime      = 0;
+MicroDisplay primaryDisplay(tft, SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_ROTATION, &touchscreen);
+static MicroDisplay* ui = &primaryDisplay;     // Current display, see "Displays"
+
+#ifdef MICRO_UI_PROFILE
+// ===== Profiler =====
+ProfileStats    profileStats[PROFILE_KINDS];
+static int8_t   profileActive       = -1;
+
+static const char* const profileNames[PROFILE_KINDS] = {
+    "touch", "button", "label", "slider", "list", "chart", "progress", "gauge", "image", "circle", "quarter",
+    "triangle", "text", "clear", "loop", "frame"
+};
+
+static inline uint32_t profileCycles() {
+    return ESP.getCycleCount();
+}
+
+// Log-scale bin: exact below 4 cycles, then 4 bins per power of two.
+static uint8_t profileBin(uint32_t cycles) {
+    if (cycles < 4) return cycles;
+    int msb = 31 - __builtin_clz(cycles);
+    return msb * 4 + ((cycles >> (msb - 2)) & 3) - 4;
+}
+
+static uint32_t profileBinUpper(uint8_t bin) {
+    if (bin < 4) return bin;
+    int msb = (bin + 4) / 4;
+    uint32_t mant = (bin + 4) % 4;
+    uint64_t next = (uint64_t)(4 + mant + 1) << (msb - 2);
+    return next > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)(next - 1);
+}
+
+static void profileRecord(ProfileKind kind, uint32_t cycles) {
+    ProfileStats &st = profileStats[kind];
+    st.count++;
+    st.totalCycles += cycles;
+    if (cycles > st.maxCycles) st.maxCycles = cycles;
+    uint16_t &bin = st.bins[profileBin(cycles)];
+    if (bin != 0xFFFF) bin++;
+}
+
+ProfileScope::ProfileScope(ProfileKind kind) : kind(kind), outer(profileActive) {
+    profileActive = kind;
+    start = profileCycles();
+}
+
+ProfileScope::~ProfileScope() {
+    profileRecord(kind, profileCycles() - start);
+    profileActive = outer;
+}
+
+// Pixels are charged to the innermost entry point being timed.
+void profileAddPixels(uint32_t pixels) {
+    if (profileActive >= 0) profileStats[profileActive].pixels += pixels;
+}
+
+uint32_t profilePercentile(ProfileKind kind, uint8_t percent) {
+    const ProfileStats &st = profileStats[kind];
+    if (st.count == 0) return 0;
+
+    uint32_t total = 0;
+    for (int i = 0; i < PROFILE_BINS; i++) total += st.bins[i];
+    uint32_t target = (total * percent + 99) / 100;
+
+    uint32_t seen = 0;
+    for (int i = 0; i < PROFILE_BINS; i++) {
+        seen += st.bins[i];
+        if (seen >= target && st.bins[i]) return min(profileBinUpper(i), st.maxCycles);
+    }
+    return st.maxCycles;
+}
+
+void microUIProfileReset() {
+    memset(profileStats, 0, sizeof(profileStats));
+}
+
+void microUIProfileDump(Print &out) {
+    uint32_t mhz = getCpuFrequencyMhz();
+    out.printf("%-9s %8s %8s %8s %8s %10s\n", "widget", "calls", "p50 us", "p99 us", "max us", "px/call");
+    for (int k = 0; k < PROFILE_KINDS; k++) {
+        const ProfileStats &st = profileStats[k];
+        if (st.count == 0) continue;
+        out.printf("%-9s %8lu %8lu %8lu %8lu %10lu\n", profileNames[k], (unsigned long)st.count,
+                   (unsigned long)(profilePercentile((ProfileKind)k, 50) / mhz),
+                   (unsigned long)(profilePercentile((ProfileKind)k, 99) / mhz),
+                   (unsigned long)(st.maxCycles / mhz),
+                   (unsigned long)(st.pixels / st.count));
+    }
+    uint32_t p50 = profilePercentile(PROFILE_FRAME, 50);
+    uint32_t p99 = profilePercentile(PROFILE_FRAME, 99);
+    out.printf("loop jitter (p99 - p50): %lu us\n", (unsigned long)((p99 - p50) / mhz));
+}
+
+// Compact table drawn with Font 1, one row per widget type that has
+// been used: name, p50/p99/max in microseconds.
+void drawProfileOverlay(int x, int y) {
+    uint32_t mhz = getCpuFrequencyMhz();
+    char row[40];
+    int rows = 0;
+    for (int k = 0; k < PROFILE_KINDS; k++) rows += profileStats[k].count ? 1 : 0;
+
+    ui->canvas->fillRect(x, y, 6 * 32 + 4, rows * 9 + 3, TFT_BLACK);
+    ui->canvas->setTextFont(1);
+    ui->canvas->setTextDatum(TL_DATUM);
+    ui->canvas->setTextColor(TFT_YELLOW, TFT_BLACK);
+    for (int k = 0; k < PROFILE_KINDS; k++) {
+        const ProfileStats &st = profileStats[k];
+        if (st.count == 0) continue;
+        snprintf(row, sizeof(row), "%-8s%7lu%7lu%7lu", profileNames[k],
+                 (unsigned long)(profilePercentile((ProfileKind)k, 50) / mhz),
+                 (unsigned long)(profilePercentile((ProfileKind)k, 99) / mhz),
+                 (unsigned long)(st.maxCycles / mhz));
+        ui->canvas->drawString(row, x + 2, y + 2);
+        y += 9;
+    }
+}
+#endif
+
+#ifdef MICRO_UI_LATENCY
+// ===== Latency =====
+LatencyStats    latencyStats;
+static bool     latencyOpen         = false;    // A touch sample is being dispatched
+static uint32_t latencySampledAt    = 0;
+static uint32_t latencyPixels       = 0;        // Pushed for the open sample
+static bool     latencyMarkerOn     = false;
+
+void latencyAddPixels(uint32_t pixels) {
+    if (latencyOpen) latencyPixels += pixels;
+}
+
+static void latencyBegin() {
+    latencySampledAt = micros();
+    latencyPixels = 0;
+    latencyOpen = true;
+}
+
+// Closes the open sample. The marker goes out with the response, before
+// the clock is read, so camera and histogram time the same thing.
+static void latencyEnd() {
+    latencyOpen = false;
+    if (!latencyPixels) return;
+#if LATENCY_MARKER_SIZE > 0
+    // Top right of the primary display, straight to its panel. The frame
+    // gets it too, unmarked, so a later flush of that corner keeps it.
+    latencyMarkerOn = !latencyMarkerOn;
+    MicroDisplay &d = primaryDisplay;
+    uint16_t color = latencyMarkerOn ? TFT_WHITE : TFT_BLACK;
+    d.panel->fillRect(d.width - LATENCY_MARKER_SIZE, 0, LATENCY_MARKER_SIZE, LATENCY_MARKER_SIZE, color);
+#ifdef MICRO_UI_FRAMEBUFFER
+    if (d.canvas != d.panel) {
+        d.frame->TFT_eSprite::fillRect(d.width - LATENCY_MARKER_SIZE, 0, LATENCY_MARKER_SIZE, LATENCY_MARKER_SIZE, color);
+    }
+#endif
+#endif
+    uint32_t us = micros() - latencySampledAt;
+
+    LatencyStats &st = latencyStats;
+    if (st.count == 0 || us < st.minMicros) st.minMicros = us;
+    if (us > st.maxMicros) st.maxMicros = us;
+    st.count++;
+    st.totalMicros += us;
+    st.lastMicros = us;
+    uint16_t &bin = st.bins[min<uint32_t>(us / LATENCY_BIN_US, LATENCY_BINS - 1)];
+    if (bin != 0xFFFF) bin++;
+}
+
+// Upper edge of the bin holding the given percentile, capped at the max.
+uint32_t latencyPercentile(uint8_t percent) {
+    const LatencyStats &st = latencyStats;
+    uint32_t total = 0;
+    for (int i = 0; i < LATENCY_BINS; i++) total += st.bins[i];
+    if (total == 0) return 0;
+    uint32_t target = (total * percent + 99) / 100;
+
+    uint32_t seen = 0;
+    for (int i = 0; i < LATENCY_BINS; i++) {
+        seen += st.bins[i];
+        if (seen >= target && st.bins[i]) return min<uint32_t>((i + 1) * LATENCY_BIN_US, st.maxMicros);
+    }
+    return st.maxMicros;
+}
+
+void microUILatencyReset() {
+    memset(&latencyStats, 0, sizeof(latencyStats));
+}
+
+void microUILatencyDump(Print &out) {
+    const LatencyStats &st = latencyStats;
+    out.printf("%8s %8s %8s %8s %8s %8s\n", "touches", "min us", "p50 us", "p99 us", "max us", "mean us");
+    out.printf("%8lu %8lu %8lu %8lu %8lu %8lu\n", (unsigned long)st.count, (unsigned long)st.minMicros,
+               (unsigned long)latencyPercentile(50), (unsigned long)latencyPercentile(99),
+               (unsigned long)st.maxMicros, (unsigned long)(st.count ? st.totalMicros / st.count : 0));
+
+    // One row per non-empty bin, bar scaled to the fullest one
+    uint16_t most = 0;
+    for (int i = 0; i < LATENCY_BINS; i++) most = max(most, st.bins[i]);
+    for (int i = 0; i < LATENCY_BINS; i++) {
+        if (!st.bins[i]) continue;
+        char bar[41];
+        int len = (st.bins[i] * 40 + most - 1) / most;
+        memset(bar, '#', len);
+        bar[len] = 0;
+        if (i == LATENCY_BINS - 1) out.printf("%5lu+   ms %6u %s\n", (unsigned long)(i * LATENCY_BIN_US / 1000), st.bins[i], bar);
+        else out.printf("%5lu-%-3lu ms %6u %s\n", (unsigned long)(i * LATENCY_BIN_US / 1000),
+                        (unsigned long)((i + 1) * LATENCY_BIN_US / 1000), st.bins[i], bar);
+    }
+}
+#endif
+
+#if defined(MICRO_UI_PROFILE) || defined(MICRO_UI_LATENCY)
+void microUICommand(int c, Print &out) {
+    switch (c) {
+#ifdef MICRO_UI_PROFILE
+        case 'p': microUIProfileDump(out); break;
+#endif
+#ifdef MICRO_UI_LATENCY
+        case 'l': microUILatencyDump(out); break;
+#endif
+        case 'r':
+#ifdef MICRO_UI_PROFILE
+            microUIProfileReset();
+#endif
+#ifdef MICRO_UI_LATENCY
+            microUILatencyReset();
+#endif
+            break;
+    }
+}
+#endif
+
+#ifdef MICRO_UI_USE_SETTINGS
+// ===== Settings Handling =====
+static int*             settingFields[MAX_SETTINGS];
+static int              settingCount        = 0;
+static uint32_t         settingsDirty       = 0;
+static unsigned long    settingsChangedAt   = 0;
+static bool             settingsFlushReq    = false;
+static volatile bool    settingsBusy        = false;
+static volatile uint32_t settingsInFlight   = 0;
+static bool             (*settingsCommit)(uint32_t dirtyMask) = nullptr;
+static TaskHandle_t     settingsTask        = nullptr;
+static portMUX_TYPE     settingsLock        = portMUX_INITIALIZER_UNLOCKED;
+
+SettingHandle addSetting(int* field) {
+    SettingHandle result;
+    if (!field || settingCount >= MAX_SETTINGS) return result;  // Error: no available setting slots
+    settingFields[settingCount] = field;
+    result.index = settingCount++;
+    return result;
+}
+
+void setSetting(SettingHandle handle, int value) {
+    if (handle.index < 0 || handle.index >= settingCount) return;
+    if (*settingFields[handle.index] == value) return;
+
+    portENTER_CRITICAL(&settingsLock);
+    *settingFields[handle.index] = value;
+    portEXIT_CRITICAL(&settingsLock);
+
+    settingsDirty |= 1UL << handle.index;
+    settingsChangedAt = millis();
+}
+
+int getSetting(SettingHandle handle) {
+    if (handle.index < 0 || handle.index >= settingCount) return 0;
+    return *settingFields[handle.index];
+}
+
+// Copy application state that the commit callback persists, without
+// tearing against a concurrent setSetting() from the loop.
+void settingsSnapshot(void* dest, const void* src, size_t len) {
+    portENTER_CRITICAL(&settingsLock);
+    memcpy(dest, src, len);
+    portEXIT_CRITICAL(&settingsLock);
+}
+
+static void settingsTaskLoop(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t mask = settingsInFlight;
+        if (settingsCommit && !settingsCommit(mask)) {
+            settingsInFlight = mask;    // Keep for the loop to retry
+        } else {
+            settingsInFlight = 0;
+        }
+        settingsBusy = false;
+    }
+}
+
+void settingsSetCommitCallback(bool (*commit)(uint32_t dirtyMask)) {
+    settingsCommit = commit;
+    if (!settingsTask) {
+        xTaskCreate(settingsTaskLoop, "uiSettings", SETTINGS_TASK_STACK, nullptr, SETTINGS_TASK_PRIORITY, &settingsTask);
+    }
+}
+
+void settingsFlush() {
+    settingsFlushReq = true;
+}
+
+bool settingsPending() {
+    return settingsDirty != 0 || settingsBusy;
+}
+
+static bool widgetCaptured();
+
+static void serviceSettings() {
+    if (settingsBusy || !settingsTask) return;
+
+    // A failed commit comes back and is retried after another quiet period.
+    if (settingsInFlight) {
+        settingsDirty |= settingsInFlight;
+        settingsInFlight = 0;
+        settingsChangedAt = millis();
+    }
+    if (!settingsDirty) {
+        settingsFlushReq = false;
+        return;
+    }
+
+    bool quiet = millis() - settingsChangedAt >= SETTINGS_QUIET_MS;
+    if (widgetCaptured()) quiet = false;    // Never while a finger is down
+    if (!quiet && !settingsFlushReq) return;
+
+    settingsInFlight = settingsDirty;
+    settingsDirty = 0;
+    settingsFlushReq = false;
+    settingsBusy = true;
+    xTaskNotifyGive(settingsTask);
+}
+#endif
+
+// ===== Widget Arena =====
+// Every widget on a display's current screen lives in that display's
+// arena, a static block handed out by a bump pointer, sprite objects
+// included. Removed widgets go on a free list per type and are reused
+// by the next add of that type. Free blocks carry no size, so a type
+// whose blocks vary (charts) is always bump-allocated and its removed
+// blocks wait for the rest. Once no widgets are left the whole block is
+// released in one step, which is what clearScreen() does when switching
+// screens.
+#define ARENA_ALIGN         8
+#define ARENA_ROUND(size)   (((size) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static uint32_t         widgetGeneration    = 0;    // Unique per add on any display, so stale handles never match
+
+static void* arenaAlloc(size_t size, void* &freeList) {
+    if (freeList) {
+        void* block = freeList;
+        freeList = *(void**)block;
+        return block;
+    }
+    size = ARENA_ROUND(size);
+    if (ui->arenaTop + size > MICRO_UI_ARENA_SIZE) return nullptr;
+    void* block = &ui->arena[ui->arenaTop];
+    ui->arenaTop += size;
+    if (ui->arenaTop > ui->arenaHigh) ui->arenaHigh = ui->arenaTop;
+    return block;
+}
+
+static void arenaFree(void* block, void* &freeList) {
+    *(void**)block = freeList;
+    freeList = block;
+}
+
+// Handles carry the arena offset of their widget.
+static int arenaOffset(const void* block) {
+    return (const uint8_t*)block - ui->arena;
+}
+
+static void* arenaAt(int offset) {
+    if (offset < 0 || (size_t)offset >= ui->arenaTop) return nullptr;
+    return &ui->arena[offset];
+}
+
+size_t microUIArenaUsed() {
+    return ui->arenaTop;
+}
+
+size_t microUIArenaPeak() {
+    return ui->arenaHigh;
+}
+
+// Hot data sits in packed arrays indexed like the live list; removing
+// entry i closes the gap so every array stays in draw order.
+template <typename T>
+static void packedRemove(T* array, int count, int i) {
+    memmove(&array[i], &array[i + 1], (count - i - 1) * sizeof(T));
+}
+
+static uint32_t bitsRemove(uint32_t bits, int i) {
+    uint32_t below = (1UL << i) - 1;
+    return (bits & below) | ((bits >> 1) & ~below);
+}
+
+static void arenaReleaseIfEmpty();
+
+// ===== Panel =====
+// The scroll registers work along the panel's native 320 lines: down
+// the screen in rotation 0, left to right in rotation 1. Lists use them
+// in portrait, slide transitions in landscape.
+#define ILI9341_VSCRDEF     0x33    // Vertical scroll area: top, height, bottom
+#define ILI9341_VSCRSADD    0x37    // Frame memory line shown first in the area
+
+static UIRect           panelClip;                  // Strip a transition is drawing
+static bool             panelClipped        = false;
+
+static void panelWrite16(uint16_t value) {
+    ui->panel->writedata(value >> 8);
+    ui->panel->writedata(value & 0xFF);
+}
+
+static void panelScrollArea(uint16_t top, uint16_t height, uint16_t bottom) {
+    ui->panel->writecommand(ILI9341_VSCRDEF);
+    panelWrite16(top);
+    panelWrite16(height);
+    panelWrite16(bottom);
+}
+
+static void panelScrollStart(uint16_t line) {
+    ui->panel->writecommand(ILI9341_VSCRSADD);
+    panelWrite16(line);
+}
+
+// ===== Framebuffer =====
+// Widgets and drawing functions draw on the current display's canvas:
+// its panel, or with MICRO_UI_FRAMEBUFFER its frame. The frame records the span of each
+// line it draws over, and microUIFlush() pushes those spans, one
+// window per block of consecutive lines whose spans overlap.
+//
+// Sprites that remain in that mode (list rows, chart columns, circles)
+// are 16-bit, since pushToSprite() only copies 16-bit into a 16-bit
+// frame, and reach the canvas through pushSpriteRect().
+
+#ifdef MICRO_UI_FRAMEBUFFER
+#define SPRITE_DEPTH        16
+
+// Dirty span of each line, [x0, x1); empty when x0 >= x1.
+static void frameMark(MicroDisplay &d, int32_t x, int32_t y, int32_t w, int32_t h) {
+    int32_t x1 = min<int32_t>(x + w, d.width);
+    int32_t y1 = min<int32_t>(y + h, d.height);
+    x = max<int32_t>(x, 0);
+    y = max<int32_t>(y, 0);
+    if (x >= x1 || y >= y1) return;
+
+    for (int32_t line = y; line < y1; line++) {
+        if (d.dirtyX0[line] >= d.dirtyX1[line]) {
+            d.dirtyX0[line] = x;
+            d.dirtyX1[line] = x1;
+        } else {
+            if (x < d.dirtyX0[line]) d.dirtyX0[line] = x;
+            if (x1 > d.dirtyX1[line]) d.dirtyX1[line] = x1;
+        }
+    }
+    if (y < d.dirtyTop) d.dirtyTop = y;
+    if (y1 > d.dirtyBottom) d.dirtyBottom = y1;
+}
+
+static void frameClean(MicroDisplay &d) {
+    for (int line = d.dirtyTop; line < d.dirtyBottom; line++) d.dirtyX1[line] = 0;
+    d.dirtyTop = d.height;
+    d.dirtyBottom = 0;
+}
+
+// The frame marks what it draws, in screen coordinates and clipped to
+// its viewport. These are the primitives every TFT_eSPI drawing call
+// ends in on a sprite, and all are virtual.
+class ShadowFrame : public TFT_eSprite {
+public:
+    explicit ShadowFrame(MicroDisplay &owner) : TFT_eSprite(owner.panel), display(owner) {
+        clip = UIRect{ 0, 0, owner.width, owner.height };
+    }
+
+    // TFT_eSPI's are not virtual; micro_ui only calls these through
+    // ShadowFrame, so marks follow the viewport.
+    void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true) {
+        TFT_eSprite::setViewport(x, y, w, h, vpDatum);
+        clip = UIRect{ (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+        datumX = vpDatum ? x : 0;
+        datumY = vpDatum ? y : 0;
+    }
+
+    void resetViewport() {
+        TFT_eSprite::resetViewport();
+        clip = UIRect{ 0, 0, display.width, display.height };
+        datumX = datumY = 0;
+    }
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) {
+        TFT_eSprite::drawPixel(x, y, color);
+        mark(x, y, 1, 1);
+    }
+
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+        TFT_eSprite::fillRect(x, y, w, h, color);
+        mark(x, y, w, h);
+    }
+
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+        TFT_eSprite::drawFastHLine(x, y, w, color);
+        mark(x, y, w, 1);
+    }
+
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+        TFT_eSprite::drawFastVLine(x, y, h, color);
+        mark(x, y, 1, h);
+    }
+
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+        TFT_eSprite::drawLine(x0, y0, x1, y1, color);
+        mark(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1);
+    }
+
+    int16_t drawChar(uint16_t c, int32_t x, int32_t y, uint8_t font) {
+        int16_t w = TFT_eSprite::drawChar(c, x, y, font);
+        mark(x, y, w, fontHeight(font));
+        return w;
+    }
+
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+        TFT_eSprite::drawChar(x, y, c, color, bg, size);
+        mark(x, y, 6 * size, 8 * size);     // Font 1 cell
+    }
+
+private:
+    void mark(int32_t x, int32_t y, int32_t w, int32_t h) {
+        x += datumX;
+        y += datumY;
+        int32_t x1 = min<int32_t>(x + w, clip.x + clip.w);
+        int32_t y1 = min<int32_t>(y + h, clip.y + clip.h);
+        x = max<int32_t>(x, clip.x);
+        y = max<int32_t>(y, clip.y);
+        if (x < x1 && y < y1) frameMark(display, x, y, x1 - x, y1 - y);
+    }
+
+    MicroDisplay &display;
+    UIRect  clip;
+    int32_t datumX = 0, datumY = 0;
+};
+
+// The frame and dirty lines are made once per display; only the
+// frame's pixels come from PSRAM.
+static void frameBegin(MicroDisplay &d) {
+    if (!d.frame) {
+        int lines = max(d.width, d.height);     // Either way round, see setDisplayRotation()
+        d.frame = new ShadowFrame(d);
+        d.dirtyX0 = new int16_t[2 * lines]();
+        d.dirtyX1 = d.dirtyX0 + lines;
+    }
+    ShadowFrame &frame = *static_cast<ShadowFrame*>(d.frame);
+    frame.setColorDepth(16);
+    if (!frame.createSprite(d.width, d.height)) return;    // No PSRAM: draw to the panel
+    frame.resetViewport();
+    frame.fillScreen(BACKGROUND_COLOR);
+    frameClean(d);                      // Matches the panel displayBegin() just cleared
+    d.canvas = &frame;
+}
+
+// Whether the current display draws on its frame, and the frame itself.
+static bool onFrame() {
+    return ui->canvas != ui->panel;
+}
+
+static ShadowFrame& frame() {
+    return *static_cast<ShadowFrame*>(ui->frame);
+}
+
+TFT_eSprite& microUIFrame() {
+    return *ui->frame;
+}
+
+void microUIInvalidate(int x, int y, int w, int h) {
+    if (onFrame()) frameMark(*ui, x, y, w, h);
+}
+
+void microUIFlush() {
+    if (!onFrame()) return;
+    MicroDisplay &d = *ui;
+    int line = d.dirtyTop;
+    while (line < d.dirtyBottom) {
+        int x0 = d.dirtyX0[line], x1 = d.dirtyX1[line];
+        if (x0 >= x1) {
+            line++;
+            continue;
+        }
+        int top = line;
+        while (++line < d.dirtyBottom && d.dirtyX0[line] < x1 && d.dirtyX1[line] > x0) {
+            x0 = min(x0, (int)d.dirtyX0[line]);
+            x1 = max(x1, (int)d.dirtyX1[line]);
+        }
+        frame().pushSprite(x0, top, x0, top, x1 - x0, line - top);
+    }
+    frameClean(d);
+}
+
+// Part of a 16-bit sprite, (sx, sy, sw, sh), drawn at (tx, ty).
+static void pushSpriteRect(TFT_eSprite &spr, int tx, int ty, int sx, int sy, int sw, int sh) {
+    if (!onFrame()) {
+        spr.pushSprite(tx, ty, sx, sy, sw, sh);
+        return;
+    }
+    frame().setViewport(tx, ty, sw, sh, false);
+    spr.pushToSprite(&frame(), tx - sx, ty - sy);
+    frame().resetViewport();
+    frameMark(*ui, tx, ty, sw, sh);
+}
+
+#if defined(MICRO_UI_USE_LABELS) || defined(MICRO_UI_USE_SLIDERS)
+// Labels and sliders, which have no sprite in this mode, draw in their
+// own coordinates through a viewport over their rect.
+static TFT_eSPI& openRect(const UIRect &r) {
+    if (onFrame()) frame().setViewport(r.x, r.y, r.w, r.h);
+    else ui->panel->setViewport(r.x, r.y, r.w, r.h);
+    return *ui->canvas;
+}
+
+static void closeRect() {
+    if (onFrame()) frame().resetViewport();
+    else ui->panel->resetViewport();
+}
+#endif
+#else
+#define SPRITE_DEPTH        8
+
+void microUIFlush() {}
+
+static void pushSpriteRect(TFT_eSprite &spr, int tx, int ty, int sx, int sy, int sw, int sh) {
+    spr.pushSprite(tx, ty, sx, sy, sw, sh);
+}
+#endif
+
+// ===== Displays =====
+// `ui` is the display every call works on; the loop handler walks
+// `displays` in the order they were added.
+static MicroDisplay*    displays[MAX_DISPLAYS]  = { &primaryDisplay };
+static uint8_t          displayCount            = 1;
+
+MicroDisplay::MicroDisplay(TFT_eSPI &panel, int16_t width, int16_t height, uint8_t rotation, XPT2046_Touchscreen *touch)
+    : panel(&panel), touch(touch), canvas(&panel), width(width), height(height), rotation(rotation) {}
+
+// Rotation, a cleared panel and, with MICRO_UI_FRAMEBUFFER, the frame.
+static void displayBegin(MicroDisplay &display) {
+    display.panel->setRotation(display.rotation);
+    display.panel->fillScreen(BACKGROUND_COLOR);
+    if (display.touch) display.touch->setRotation(display.rotation);
+#ifdef MICRO_UI_FRAMEBUFFER
+    frameBegin(display);
+#endif
+}
+
+bool microUIAddDisplay(MicroDisplay &display) {
+    for (int d = 0; d < displayCount; d++) {
+        if (displays[d] == &display) return true;
+    }
+    if (displayCount == MAX_DISPLAYS) return false;
+    displayBegin(display);
+    displays[displayCount++] = &display;
+    return true;
+}
+
+void useDisplay(MicroDisplay &display) {
+    ui = &display;
+}
+
+MicroDisplay& currentDisplay() {
+    return *ui;
+}
+
+void setDisplayRotation(uint8_t rotation) {
+    if ((rotation ^ ui->rotation) & 1) {
+        int16_t w = ui->width;
+        ui->width = ui->height;
+        ui->height = w;
+    }
+    ui->rotation = rotation;
+#ifdef MICRO_UI_FRAMEBUFFER
+    if (ui->frame) ui->frame->deleteSprite();   // Made again the other way round
+    ui->canvas = ui->panel;
+#endif
+    displayBegin(*ui);
+}
+
+// ===== Widget Registry =====
+// Every widget type is a traits struct deriving from Widget<>, which
+// owns storage, handle validation and the shared draw, hit-test and
+// remove loops. Widget<> reaches the type only through its static
+// functions, so there are no vtables and no per-widget function
+// pointers; anything a type does not define falls back to the no-op
+// defaults below. WidgetRegistry<> chains the enabled types so one call
+// covers all of them, and a type whose MICRO_UI_USE_* is off is simply
+// left out of the list and compiles away.
+//
+// Adding a widget type: a cold struct with a `generation` field, a
+// WidgetStore for it, a traits struct providing store() and draw(i)
+// (plus press/drag/lift if `touchable`, and `fixedSize` false if its
+// block size varies), and an entry in `Widgets`.
+
+// ===== Event Queue =====
+// A ring of EVENT_QUEUE_SIZE events per display, drained at the end of
+// each loop pass (see dispatchEvents()).
+
+static void postEvent(UIEventType type, UIWidgetKind widget, int index, uint32_t generation, int id, int value) {
+    if (ui->eventCount == EVENT_QUEUE_SIZE) {
+        ui->eventsDropped++;
+        return;
+    }
+    UIEvent &event = ui->eventQueue[(ui->eventHead + ui->eventCount++) % EVENT_QUEUE_SIZE];
+    event.type = type;
+    event.widget = widget;
+    event.value = value;
+    event.id = id;
+    event.x = ui->touchCapture.x;
+    event.y = ui->touchCapture.y;
+    event.index = index;
+    event.generation = generation;
+}
+
+void setEventHandler(UIEventCallback handler, void *context) {
+    ui->eventHandler = handler;
+    ui->eventContext = context;
+}
+
+uint32_t microUIEventsDropped() {
+    return ui->eventsDropped;
+}
+
+template <typename Derived, typename Cold, int Max>
+struct Widget {
+    typedef WidgetStore<Cold, Max>  Store;
+    typedef WidgetHandle<Cold>      Handle;
+
+    static_assert(Max <= 32, "Widget flags are 32-bit masks");
+
+    static const bool touchable = false;
+    static const bool fixedSize = true;     // False keeps blocks off the free list
+    static void release(Cold&) {}
+    static void press(int, int, int) {}
+    static void drag(int, int, int) {}
+    static void lift(Handle) {}
+    static void fire(const UIEvent&) {}
+    static int  eventId(int) { return 0; }
+
+    // Live index of the widget a handle refers to, or -1.
+    static int find(Handle handle) {
+        Store &s = Derived::store();
+        Cold* widget = (Cold*)arenaAt(handle.index);
+        if (!widget) return -1;
+        for (int i = 0; i < s.count; i++) {
+            if (s.list[i] == widget) return widget->generation == handle.generation ? i : -1;
+        }
+        return -1;
+    }
+
+    static Handle handleAt(int i) {
+        Store &s = Derived::store();
+        Handle handle;
+        handle.index = arenaOffset(s.list[i]);
+        handle.generation = s.list[i]->generation;
+        return handle;
+    }
+
+    static Handle handleOf(const UIEvent &event) {
+        Handle handle;
+        handle.index = event.index;
+        handle.generation = event.generation;
+        return handle;
+    }
+
+    static void post(UIEventType type, int i, int value = 0) {
+        Handle handle = handleAt(i);
+        postEvent(type, Derived::kind, handle.index, handle.generation, Derived::eventId(i), value);
+    }
+
+    // Claims `size` bytes for the widget and anything kept behind it;
+    // returns the new live index, or -1 when the arena or list is full.
+    static int add(size_t size, int x, int y, int w, int h) {
+        Store &s = Derived::store();
+        if (s.count >= Max) return -1;
+        void* none = nullptr;
+        void* block = arenaAlloc(size, Derived::fixedSize ? s.freeList : none);
+        if (!block) return -1;
+
+        int i = s.count++;
+        s.list[i] = new (block) Cold();
+        s.list[i]->generation = ++widgetGeneration;
+        s.rect[i] = UIRect{ (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+        s.visible |= 1UL << i;
+        s.pressed &= ~(1UL << i);
+        return i;
+    }
+
+    static void remove(int i) {
+        Store &s = Derived::store();
+        Derived::release(*s.list[i]);
+        if (Derived::fixedSize) arenaFree(s.list[i], s.freeList);
+        packedRemove(s.list, s.count, i);
+        packedRemove(s.rect, s.count, i);
+        s.visible = bitsRemove(s.visible, i);
+        s.pressed = bitsRemove(s.pressed, i);
+        s.count--;
+        arenaReleaseIfEmpty();
+    }
+
+    static void removeAll() {
+        Store &s = Derived::store();
+        for (int i = 0; i < s.count; i++) {
+            Derived::release(*s.list[i]);
+            if (Derived::fixedSize) arenaFree(s.list[i], s.freeList);
+        }
+        s.count = 0;
+        s.visible = 0;
+        s.pressed = 0;
+        arenaReleaseIfEmpty();
+    }
+
+    static void drawAll() {
+        for (int i = 0; i < Derived::store().count; i++) Derived::draw(i);
+    }
+
+    // Only the packed rects are read until a hit.
+    static int hitTest(int tx, int ty) {
+        if (!Derived::touchable) return -1;
+        Store &s = Derived::store();
+        for (uint32_t live = s.visible; live; live &= live - 1) {
+            int i = __builtin_ctz(live);
+            const UIRect &r = s.rect[i];
+            if (tx >= r.x && tx <= (r.x + r.w) &&
+                ty >= r.y && ty <= (r.y + r.h)) return i;
+        }
+        return -1;
+    }
+};
+
+struct WidgetListEnd {};
+
+template <typename... Types> struct WidgetRegistry;
+
+template <> struct WidgetRegistry<WidgetListEnd> {
+    static void drawAll() {}
+    static void removeAll() {}
+    static bool empty() { return true; }
+    static void resetFreeLists() {}
+    static bool press(int, int, int8_t) { return false; }
+    static void drag(int8_t, int, int) {}
+    static void lift(int8_t) {}
+    static void fire(const UIEvent&) {}
+};
+
+template <typename First, typename... Rest>
+struct WidgetRegistry<First, Rest...> {
+    typedef WidgetRegistry<Rest...> Next;
+
+    static void drawAll()           { First::drawAll(); Next::drawAll(); }
+    static void removeAll()         { First::removeAll(); Next::removeAll(); }
+    static bool empty()             { return First::store().count == 0 && Next::empty(); }
+    static void resetFreeLists()    { First::store().freeList = nullptr; Next::resetFreeLists(); }
+
+    // Capture the first widget under the finger, in registry order.
+    static bool press(int tx, int ty, int8_t type) {
+        int i = First::hitTest(tx, ty);
+        if (i < 0) return Next::press(tx, ty, type + 1);
+
+        typename First::Handle handle = First::handleAt(i);
+        ui->touchCapture.type = type;
+        ui->touchCapture.index = handle.index;
+        ui->touchCapture.generation = handle.generation;
+        ui->touchCapture.x = tx;
+        ui->touchCapture.y = ty;
+        ui->touchStartTime = millis();
+        First::press(i, tx, ty);
+        First::post(EVENT_PRESS, i);
+        return true;
+    }
+
+    static void drag(int8_t type, int tx, int ty) {
+        if (type > 0) return Next::drag(type - 1, tx, ty);
+        int i = First::find(captured());
+        if (i >= 0) First::drag(i, tx, ty);
+    }
+
+    static void lift(int8_t type) {
+        if (type > 0) return Next::lift(type - 1);
+        int i = First::find(captured());
+        if (i >= 0) First::post(EVENT_RELEASE, i);
+        First::lift(captured());
+    }
+
+    static void fire(const UIEvent &event) {
+        if (event.widget == First::kind) First::fire(event);
+        else Next::fire(event);
+    }
+
+    static typename First::Handle captured() {
+        typename First::Handle handle;
+        handle.index = ui->touchCapture.index;
+        handle.generation = ui->touchCapture.generation;
+        return handle;
+    }
+};
+
+#if defined(MICRO_UI_USE_BUTTONS) || defined(MICRO_UI_USE_LABELS)
+// ===== Text Layout =====
+// Glyph advances of the built-in TFT_eSPI fonts, measured with
+// textWidth() the first time a font is used. Laying text out is then a
+// table walk, and drawing it one drawChar() per glyph at a known spot.
+// Advances come from the font tables, not the panel, so every display
+// shares the cache and it is always measured on tft.
+struct FontAdvances {
+    uint8_t font;                   // 0 = slot unused
+    uint8_t height;
+    uint8_t advance[95];            // ' ' to '~'
+};
+
+static FontAdvances fontAdvanceCache[TEXT_FONT_CACHE];
+static uint8_t fontAdvanceNext;     // Slot reused when another font turns up
+
+static const FontAdvances& fontAdvances(uint8_t font) {
+    for (const FontAdvances &f : fontAdvanceCache) {
+        if (f.font == font) return f;
+    }
+    FontAdvances &f = fontAdvanceCache[fontAdvanceNext];
+    fontAdvanceNext = (fontAdvanceNext + 1) % TEXT_FONT_CACHE;
+
+    char glyph[2] = { 0, 0 };
+    for (int c = 0; c < 95; c++) {
+        glyph[0] = ' ' + c;
+        f.advance[c] = tft.textWidth(glyph, font);
+    }
+    f.height = tft.fontHeight(font);
+    f.font = font;
+    return f;
+}
+
+static int glyphAdvance(const FontAdvances &f, char c) {
+    uint8_t code = (uint8_t)c - ' ';
+    if (code < 95) return f.advance[code];
+    char glyph[2] = { c, 0 };       // Outside the table: measure it as before
+    return tft.textWidth(glyph, f.font);
+}
+
+// Measures text; the caller then places it with centreText().
+static void layoutText(TextLayout &layout, const char *text, uint8_t font) {
+    const FontAdvances &f = fontAdvances(font);
+    int width = 0;
+    for (const char *p = text; *p; p++) width += glyphAdvance(f, *p);
+    layout.width = width;
+    layout.height = f.height;
+    layout.font = font;
+}
+
+// Same placement as drawString() with MC_DATUM at (cx, cy).
+static void centreText(TextLayout &layout, int cx, int cy) {
+    layout.x = cx - layout.width / 2;
+    layout.y = cy - layout.height / 2;
+}
+
+// Draws laid-out text with the target's current text colours, relative
+// to (x, y). Works on the panel and on sprites alike.
+static void drawLaidOutText(TFT_eSPI &dst, const TextLayout &layout, const char *text, int x, int y) {
+    const FontAdvances &f = fontAdvances(layout.font);
+    x += layout.x;
+    y += layout.y;
+    for (const char *p = text; *p; p++) {
+        dst.drawChar((uint8_t)*p, x, y, layout.font);
+        x += glyphAdvance(f, *p);
+    }
+}
+#endif
 
 #ifdef MICRO_UI_USE_BUTTONS
 // ===== Button Handling =====
-SimpleButton    buttonList[MAX_BUTTONS];
-int             currentButtonIndex  = -1;
 
-ButtonHandle addButton(int x, int y, int w, int h, const char *label, void (*callback)(const char *label), uint8_t fontCode, uint16_t bgNormal, uint16_t bgPressed) {
-    for (int i = 0; i < MAX_BUTTONS; i++) {
-        if (!buttonList[i].inUse) {
-            SimpleButton &btn = buttonList[i];
-            btn.x = x;
-            btn.y = y;
-            btn.w = w;
-            btn.h = h;
-            safeCopy(btn.label, label, MAX_BUTTON_TEXT);
-            btn.callback = callback;
-            btn.visible = true;
-            btn.fontCode = fontCode;
-            btn.bgNormal = bgNormal;
-            btn.bgPressed = bgPressed;
-            btn.pressed = false;
-            btn.generation++;
-            btn.inUse = true;
-            
-            ButtonHandle result; 
-            result.index = i; 
-            result.generation = btn.generation; 
-            return result;
-        }
-    }
-    ButtonHandle result;
-    result.index = -1; 
-    result.generation = 0;  // Error: no available button slots
-    return result;
+// Buttons up to BUTTON_FACE_MAX_PIXELS borrow a 4-bit sprite from this
+// pool the first time they are drawn. Palette entry FACE_BG is the
+// background and FACE_INK the frame and text, so press and release only
+// change FACE_BG and push the face again: one window, nothing redrawn.
+// A button that finds no free slot, or no heap, draws straight to the
+// panel instead. With MICRO_UI_FRAMEBUFFER every button draws on the
+// frame, which a 4-bit face cannot be copied into, so there is no pool.
+// All displays share the pool; a sprite pushes to the panel it was made
+// for, so a slot is made again when a button on another panel claims it.
+#define FACE_BG     0
+#define FACE_INK    1
+
+#if BUTTON_FACES > 0 && !defined(MICRO_UI_FRAMEBUFFER)
+static uint8_t buttonFacePool[BUTTON_FACES][ARENA_ROUND(sizeof(TFT_eSprite))] __attribute__((aligned(ARENA_ALIGN)));
+static TFT_eSPI* buttonFacePanel[BUTTON_FACES];    // Panel of each slot's sprite object, nullptr until made
+static uint32_t buttonFaceUsed;     // Bit per slot lent to a button
+static_assert(BUTTON_FACES <= 32, "Button face slots are a 32-bit mask");
+
+static TFT_eSprite* buttonFace(const SimpleButton &btn) {
+    return btn.face ? (TFT_eSprite*)buttonFacePool[btn.face - 1] : nullptr;
+}
+
+static TFT_eSprite* claimButtonFace(SimpleButton &btn, int w, int h) {
+    if (btn.face) return buttonFace(btn);
+    if (w * h > BUTTON_FACE_MAX_PIXELS) return nullptr;
+    for (int slot = 0; slot < BUTTON_FACES; slot++) {
+        uint32_t bit = 1UL << slot;
+        if (buttonFaceUsed & bit) continue;
+        TFT_eSprite *face = (TFT_eSprite*)buttonFacePool[slot];
+        if (buttonFacePanel[slot] != ui->panel) {
+            if (buttonFacePanel[slot]) face->~TFT_eSprite();
+            new (face) TFT_eSprite(ui->panel);
+            buttonFacePanel[slot] = ui->panel;
+        }
+        face->setColorDepth(4);
+        if (!face->createSprite(w, h)) return nullptr;     // Out of heap
+        buttonFaceUsed |= bit;
+        btn.face = slot + 1;
+        return face;
+    }
+    return nullptr;
+}
+
+static void releaseButtonFace(SimpleButton &btn) {
+    if (!btn.face) return;
+    buttonFace(btn)->deleteSprite();
+    buttonFaceUsed &= ~(1UL << (btn.face - 1));
+    btn.face = 0;
+}
+#else
+static TFT_eSprite* buttonFace(const SimpleButton &) { return nullptr; }
+static TFT_eSprite* claimButtonFace(SimpleButton &, int, int) { return nullptr; }
+static void releaseButtonFace(SimpleButton &) {}
+#endif
+
+struct ButtonWidget : Widget<ButtonWidget, SimpleButton, MAX_BUTTONS> {
+    static const UIWidgetKind kind = WIDGET_BUTTON;
+    static const bool touchable = true;
+    static Store& store() { return ui->buttons; }
+
+    // The label sits centred, 2 px low, and is only measured again
+    // once updateButton() changes it.
+    static const TextLayout& layout(int i) {
+        SimpleButton &btn = *ui->buttons.list[i];
+        if (btn.layout.font != btn.fontCode) {
+            const UIRect &r = ui->buttons.rect[i];
+            layoutText(btn.layout, btn.label, btn.fontCode);
+            centreText(btn.layout, r.w / 2, r.h / 2 + 2);
+        }
+        return btn.layout;
+    }
+
+    static uint16_t bgColor(int i) {
+        const SimpleButton &btn = *ui->buttons.list[i];
+        return (ui->buttons.pressed & (1UL << i)) ? btn.bgPressed : btn.bgNormal;
+    }
+
+    static void draw(int i) {
+        if (!(ui->buttons.visible & (1UL << i)))
+            return;
+        const UIRect &r = ui->buttons.rect[i];
+        SimpleButton &btn = *ui->buttons.list[i];
+        UI_PROFILE_SCOPE(PROFILE_BUTTON);
+
+        TFT_eSprite *face = claimButtonFace(btn, r.w, r.h);
+        if (face) {
+            face->fillSprite(FACE_BG);
+            face->drawRect(0, 0, r.w, r.h, FACE_INK);
+            face->setTextColor(FACE_INK, FACE_BG);
+            drawLaidOutText(*face, layout(i), btn.label, 0, 0);
+            pushFace(i, face);
+            return;
+        }
+
+        UI_PROFILE_PIXELS(r.w * r.h + 2 * (r.w + r.h));
+        uint16_t bg = bgColor(i);
+        ui->canvas->fillRect(r.x, r.y, r.w, r.h, bg);
+        ui->canvas->drawRect(r.x, r.y, r.w, r.h, TFT_WHITE);
+        ui->canvas->setTextColor(TFT_WHITE, bg);
+        drawLaidOutText(*ui->canvas, layout(i), btn.label, r.x, r.y);
+    }
+
+    // Pushes the face, or with `inset` 1 only what lies inside the frame.
+    static void pushFace(int i, TFT_eSprite *face, int inset = 0) {
+        const UIRect &r = ui->buttons.rect[i];
+        face->setPaletteColor(FACE_BG, bgColor(i));
+        face->setPaletteColor(FACE_INK, TFT_WHITE);
+        face->pushSprite(r.x + inset, r.y + inset, inset, inset, r.w - 2 * inset, r.h - 2 * inset);
+        UI_PROFILE_PIXELS((r.w - 2 * inset) * (r.h - 2 * inset));
+    }
+
+    // Press feedback. A button with a face only swaps its palette and
+    // pushes the inside of the frame again. One without keeps the frame
+    // and glyph positions, so only the inside of the frame around the
+    // text box is refilled and the glyphs repaint their own cells in the
+    // new colour.
+    static void swapColour(int i) {
+        if (!(ui->buttons.visible & (1UL << i)))
+            return;
+        TFT_eSprite *face = buttonFace(*ui->buttons.list[i]);
+        if (face) {
+            UI_PROFILE_SCOPE(PROFILE_BUTTON);
+            return pushFace(i, face, 1);
+        }
+        uint16_t bg = bgColor(i);
+        if (bg == TFT_WHITE) return draw(i);    // Glyphs would draw without cells
+
+        const UIRect &r = ui->buttons.rect[i];
+        const TextLayout &t = layout(i);
+        UI_PROFILE_SCOPE(PROFILE_BUTTON);
+        UI_PROFILE_PIXELS((r.w - 2) * (r.h - 2));
+
+        // Inside of the frame, and the text box clipped to it
+        int x0 = r.x + 1, y0 = r.y + 1, x1 = r.x + r.w - 1, y1 = r.y + r.h - 1;
+        int tx0 = constrain(r.x + t.x, x0, x1), tx1 = constrain(r.x + t.x + t.width, x0, x1);
+        int ty0 = constrain(r.y + t.y, y0, y1), ty1 = constrain(r.y + t.y + t.height, y0, y1);
+        fillArea(x0, y0, x1 - x0, ty0 - y0, bg);
+        fillArea(x0, ty1, x1 - x0, y1 - ty1, bg);
+        fillArea(x0, ty0, tx0 - x0, ty1 - ty0, bg);
+        fillArea(tx1, ty0, x1 - tx1, ty1 - ty0, bg);
+
+        ui->canvas->setTextColor(TFT_WHITE, bg);
+        drawLaidOutText(*ui->canvas, t, ui->buttons.list[i]->label, r.x, r.y);
+    }
+
+    static void fillArea(int x, int y, int w, int h, uint16_t color) {
+        if (w > 0 && h > 0) ui->canvas->fillRect(x, y, w, h, color);
+    }
+
+    static void press(int i, int, int) {
+        ui->buttons.pressed |= 1UL << i;
+        swapColour(i);
+    }
+
+    static void release(SimpleButton &btn) {
+        releaseButtonFace(btn);
+    }
+
+    static void lift(Handle handle) {
+        int i = find(handle);
+        if (i < 0) return;
+        if (millis() - ui->touchStartTime >= BUTTON_DEBOUNCE_MS) post(EVENT_CLICK, i);
+        ui->buttons.pressed &= ~(1UL << i);
+        swapColour(i);
+    }
+
+    static int eventId(int i) { return ui->buttons.list[i]->id; }
+
+    static void fire(const UIEvent &event) {
+        if (event.type != EVENT_CLICK) return;
+        int i = find(handleOf(event));
+        if (i < 0) return;
+        // Either callback may switch screens, which recycles the arena,
+        // so take what is needed before calling them.
+        SimpleButton &btn = *ui->buttons.list[i];
+        void (*callback)(const char*) = btn.callback;
+        UIEventCallback onEvent = btn.onEvent;
+        void* context = btn.context;
+        char label[MAX_BUTTON_TEXT];
+        if (callback) safeCopy(label, btn.label, MAX_BUTTON_TEXT);
+
+        if (callback) callback(label);
+        if (onEvent) onEvent(event, context);
+    }
+};
+
+ButtonHandle addButton(int x, int y, int w, int h, const char *label, void (*callback)(const char *label), uint8_t fontCode, uint16_t bgNormal, uint16_t bgPressed) {
+    int i = ButtonWidget::add(sizeof(SimpleButton), x, y, w, h);
+    if (i < 0) return ButtonHandle();   // Error: arena or live list full
+
+    SimpleButton &btn = *ui->buttons.list[i];
+    safeCopy(btn.label, label, MAX_BUTTON_TEXT);
+    btn.callback = callback;
+    btn.fontCode = fontCode;
+    btn.bgNormal = bgNormal;
+    btn.bgPressed = bgPressed;
+    return ButtonWidget::handleAt(i);
+}
+
+ButtonHandle addButton(int x, int y, int w, int h, const char *label, int id, UIEventCallback callback, void *context, uint8_t fontCode, uint16_t bgNormal, uint16_t bgPressed) {
+    ButtonHandle handle = addButton(x, y, w, h, label, nullptr, fontCode, bgNormal, bgPressed);
+    setCallback(handle, id, callback, context);
+    return handle;
+}
+
+void setCallback(ButtonHandle handle, int id, UIEventCallback callback, void *context) {
+    int i = ButtonWidget::find(handle);
+    if (i < 0) return;
+    SimpleButton &btn = *ui->buttons.list[i];
+    btn.onEvent = callback;
+    btn.context = context;
+    btn.id = id;
+}
+
+void updateButton(ButtonHandle handle, const char* newLabel, uint16_t bgNormal, uint16_t bgPressed) {
+    int i = ButtonWidget::find(handle);
+    if (i < 0) return;
+    ui->buttons.list[i]->bgNormal = bgNormal;
+    ui->buttons.list[i]->bgPressed = bgPressed;
+    updateButton(handle, newLabel);
+}
+
+void updateButton(ButtonHandle handle, const char* newLabel, uint16_t bgNormal) {
+    int i = ButtonWidget::find(handle);
+    if (i < 0) return;
+    ui->buttons.list[i]->bgNormal = bgNormal;
+    updateButton(handle, newLabel);
+}
+
+void updateButton(ButtonHandle handle, const char* newLabel) {
+    int i = ButtonWidget::find(handle);
+    if (i < 0) return;
+    SimpleButton &btn = *ui->buttons.list[i];
+    if (strncmp(btn.label, newLabel, MAX_BUTTON_TEXT) != 0) {
+        safeCopy(btn.label, newLabel, MAX_BUTTON_TEXT);
+        btn.layout.font = 0;            // Measure again on the next draw
+    }
+    ButtonWidget::draw(i);
+}
+
+void drawButton(ButtonHandle handle) {
+    int i = ButtonWidget::find(handle);
+    if (i >= 0) ButtonWidget::draw(i);
+}
+
+void drawAllButtons() {
+    ButtonWidget::drawAll();
+}
+
+void clearButton(ButtonHandle handle) {
+    int i = ButtonWidget::find(handle);
+    if (i < 0) return;
+    const UIRect &r = ui->buttons.rect[i];
+    ui->canvas->fillRect(r.x, r.y, r.w, r.h, BACKGROUND_COLOR);
+    ui->canvas->drawRect(r.x, r.y, r.w, r.h, TFT_WHITE);
+}
+
+void removeButton(ButtonHandle handle) {
+    int i = ButtonWidget::find(handle);
+    if (i >= 0) ButtonWidget::remove(i);
+}
+
+void removeAllButtons() {
+    ButtonWidget::removeAll();
+}
+#endif
+
+
+#ifdef MICRO_UI_USE_LABELS
+// ===== Label Handling =====
+// A label's sprite object sits in the same arena block, right after it.
+// With MICRO_UI_FRAMEBUFFER there is no sprite; the label draws on the
+// frame through a viewport over its rect instead, in the same
+// coordinates.
+#ifdef MICRO_UI_FRAMEBUFFER
+#define LABEL_BLOCK_SIZE    sizeof(LabelSprite)
+#else
+#define LABEL_BLOCK_SIZE    (ARENA_ROUND(sizeof(LabelSprite)) + sizeof(TFT_eSprite))
+#endif
+
+
+struct LabelWidget : Widget<LabelWidget, LabelSprite, MAX_LABELS> {
+    static const UIWidgetKind kind = WIDGET_LABEL;
+    static Store& store() { return ui->labels; }
+
+    // Background and laid-out lastText at the label's current size.
+    static void render(int i) {
+        const LabelSprite &lbl = *ui->labels.list[i];
+        const UIRect &r = ui->labels.rect[i];
+#ifdef MICRO_UI_FRAMEBUFFER
+        TFT_eSPI &dst = openRect(r);
+#else
+        TFT_eSPI &dst = *lbl.sprite;
+#endif
+        dst.fillRect(0, 0, r.w, r.h, lbl.bgColor);
+        dst.setTextColor(lbl.textColor, lbl.bgColor);
+        drawLaidOutText(dst, lbl.layout, lbl.lastText, 0, 0);
+#ifdef MICRO_UI_FRAMEBUFFER
+        closeRect();
+#else
+        lbl.sprite->pushSprite(r.x, r.y);
+#endif
+        UI_PROFILE_PIXELS(r.w * r.h);
+    }
+
+    // The sprite still holds the last text; just push it again. The
+    // frame may have been drawn over, so there it is rendered again.
+    static void draw(int i) {
+        UI_PROFILE_SCOPE(PROFILE_LABEL);
+#ifdef MICRO_UI_FRAMEBUFFER
+        render(i);
+#else
+        const UIRect &r = ui->labels.rect[i];
+        ui->labels.list[i]->sprite->pushSprite(r.x, r.y);
+        UI_PROFILE_PIXELS(r.w * r.h);
+#endif
+    }
+
+#ifndef MICRO_UI_FRAMEBUFFER
+    static void release(LabelSprite &lbl) {
+        lbl.sprite->~TFT_eSprite();     // Frees the pixel buffer
+        lbl.sprite = nullptr;
+    }
+#endif
+};
+
+LabelHandle addLabel(int x, int y, const char* text, uint8_t fontCode, uint16_t textColor, uint16_t bgColor) {
+    UI_PROFILE_SCOPE(PROFILE_LABEL);
+
+    TextLayout layout;
+    layoutText(layout, text, fontCode);
+    int w = layout.width + 10;
+    int h = layout.height + 4;
+
+    // Clip width/height to screen
+    if (x + w > ui->width) w = ui->width - x;
+    if (y + h > ui->height) h = ui->height - y;
+
+    // Fallback if it's still out of bounds
+    if (w <= 0 || h <= 0) return LabelHandle();
+
+    int i = LabelWidget::add(LABEL_BLOCK_SIZE, x, y, w, h);
+    if (i < 0) return LabelHandle();    // Error: arena or live list full
+
+    LabelSprite &lbl = *ui->labels.list[i];
+    safeCopy(lbl.lastText, text, MAX_LABEL_TEXT);
+    lbl.fontCode = fontCode;
+    lbl.textColor = textColor;
+    lbl.bgColor = bgColor;
+    lbl.layout = layout;
+    centreText(lbl.layout, w / 2, h / 2);
+
+#ifndef MICRO_UI_FRAMEBUFFER
+    lbl.sprite = new ((uint8_t*)&lbl + ARENA_ROUND(sizeof(LabelSprite))) TFT_eSprite(ui->panel);
+    lbl.sprite->setColorDepth(8);
+    lbl.sprite->createSprite(w, h);
+#endif
+    LabelWidget::render(i);
+
+    return LabelWidget::handleAt(i);
+}
+
+void updateLabel(LabelHandle handle, const char* text) {
+    int i = LabelWidget::find(handle);
+    if (i < 0) return;
+    updateLabel(handle, text, ui->labels.list[i]->textColor, ui->labels.list[i]->bgColor);
+}
+
+void updateLabel(LabelHandle handle, const char* text, uint16_t textColor) {
+    int i = LabelWidget::find(handle);
+    if (i < 0) return;
+    ui->labels.list[i]->textColor = textColor;
+    updateLabel(handle, text, textColor, ui->labels.list[i]->bgColor);
+}
+
+void updateLabel(LabelHandle handle, const char* text, uint16_t textColor, uint16_t bgColor) {
+    int i = LabelWidget::find(handle);
+    if (i < 0) return;
+    LabelSprite &lbl = *ui->labels.list[i];
+    UIRect &r = ui->labels.rect[i];
+
+    if (strncmp(lbl.lastText, text, MAX_LABEL_TEXT) != 0) {
+        UI_PROFILE_SCOPE(PROFILE_LABEL);
+        // Measured from the font's cached advances; no scratch sprite
+        layoutText(lbl.layout, text, lbl.fontCode);
+        int newW = lbl.layout.width + 10;
+        int newH = lbl.layout.height + 4;
+
+        // Clip to screen bounds
+        if (r.x + newW > ui->width) newW = ui->width - r.x;
+        if (r.y + newH > ui->height) newH = ui->height - r.y;
+
+        // Save previous size for cleanup
+        int prevW = r.w;
+        int prevH = r.h;
+
+        // Resize sprite if needed; the sprite object stays in the arena
+        if (newW != r.w || newH != r.h) {
+            r.w = newW;
+            r.h = newH;
+#ifndef MICRO_UI_FRAMEBUFFER
+            lbl.sprite->deleteSprite();
+            lbl.sprite->setColorDepth(8);
+            lbl.sprite->createSprite(r.w, r.h);
+#endif
+        }
+        centreText(lbl.layout, r.w / 2, r.h / 2);
+
+        // Track last label, then draw it in the new colours
+        safeCopy(lbl.lastText, text, MAX_LABEL_TEXT);
+        lbl.textColor = textColor;
+        lbl.bgColor = bgColor;
+        LabelWidget::render(i);
+
+        // Clear leftover area from previous larger label
+        if (prevW > r.w) {
+            int dx = prevW - r.w;
+            ui->canvas->fillRect(r.x + r.w, r.y, dx, r.h, bgColor);
+            UI_PROFILE_PIXELS(dx * r.h);
+        }
+        if (prevH > r.h) {
+            int dy = prevH - r.h;
+            ui->canvas->fillRect(r.x, r.y + r.h, r.w, dy, bgColor);
+            UI_PROFILE_PIXELS(r.w * dy);
+        }
+    }
+}
+
+void clearLabel(LabelHandle handle) {
+    int i = LabelWidget::find(handle);
+    if (i < 0) return;
+#ifdef MICRO_UI_FRAMEBUFFER
+    const UIRect &r = ui->labels.rect[i];
+    ui->canvas->fillRect(r.x, r.y, r.w, r.h, ui->labels.list[i]->bgColor);
+    ui->labels.list[i]->lastText[0] = '\0';     // So draw() leaves it blank too
+#else
+    ui->labels.list[i]->sprite->fillSprite(ui->labels.list[i]->bgColor);
+    ui->labels.list[i]->sprite->pushSprite(ui->labels.rect[i].x, ui->labels.rect[i].y);
+#endif
+}
+
+void removeLabel(LabelHandle handle) {
+    int i = LabelWidget::find(handle);
+    if (i >= 0) LabelWidget::remove(i);
+}
+
+void removeAllLabels() {
+    LabelWidget::removeAll();
+}
+#endif
+
+#ifdef MICRO_UI_USE_SLIDERS
+// ===== Slider Functions =====
+// Like labels, each slider block carries its sprite object, or with
+// MICRO_UI_FRAMEBUFFER draws on the frame in the same coordinates.
+#ifdef MICRO_UI_FRAMEBUFFER
+#define SLIDER_BLOCK_SIZE   sizeof(SliderSprite)
+#else
+#define SLIDER_BLOCK_SIZE   (ARENA_ROUND(sizeof(SliderSprite)) + sizeof(TFT_eSprite))
+#endif
+
+
+struct SliderWidget : Widget<SliderWidget, SliderSprite, MAX_SLIDERS> {
+    static const UIWidgetKind kind = WIDGET_SLIDER;
+    static const bool touchable = true;
+    static Store& store() { return ui->sliders; }
+
+    static int thumbX(const UIRect &r, int value) {
+        return (value * (r.w - SLIDER_BUTTON_SIZE)) / 100;
+    }
+
+    static bool shown(int i) {
+        if (!(ui->sliders.visible & (1UL << i))) return false;
+#ifdef MICRO_UI_FRAMEBUFFER
+        return true;
+#else
+        return ui->sliders.list[i]->sprite != nullptr;
+#endif
+    }
+
+    // Where the slider is drawn, in its own coordinates, until
+    // closeSurface(); present() then sends a part of it to the panel.
+    static TFT_eSPI& surface(int i) {
+#ifdef MICRO_UI_FRAMEBUFFER
+        return openRect(ui->sliders.rect[i]);
+#else
+        return *ui->sliders.list[i]->sprite;
+#endif
+    }
+
+    static void closeSurface() {
+#ifdef MICRO_UI_FRAMEBUFFER
+        closeRect();
+#endif
+    }
+
+    // On the frame the pixels are in place already.
+    static void present(int i, int x, int y, int w, int h) {
+#ifndef MICRO_UI_FRAMEBUFFER
+        const UIRect &r = ui->sliders.rect[i];
+        ui->sliders.list[i]->sprite->pushSprite(r.x + x, r.y + y, x, y, w, h);
+#else
+        (void)i; (void)x; (void)y; (void)w; (void)h;
+#endif
+        UI_PROFILE_PIXELS(w * h);
+    }
+
+    // Restores background and track under columns [x0, x0 + w) of the
+    // thumb's rows. Returns the rows touched, clipped to the slider.
+    static void clearBand(TFT_eSPI &dst, int i, int x0, int w, int &y0, int &h) {
+        const SliderSprite &sldr = *ui->sliders.list[i];
+        const UIRect &r = ui->sliders.rect[i];
+        int thumbY = (r.h - SLIDER_BUTTON_SIZE) / 2;
+        y0 = max(thumbY, 0);
+        h = min(thumbY + SLIDER_BUTTON_SIZE, (int)r.h) - y0;
+
+        int trackY = (r.h - SLIDER_TRACK_THICKNESS) / 2;
+        dst.fillRect(x0, y0, w, h, BACKGROUND_COLOR);
+        dst.fillRect(x0, trackY, w, SLIDER_TRACK_THICKNESS, sldr.trackColor);
+    }
+
+    static void drawThumb(TFT_eSPI &dst, int i) {
+        const SliderSprite &sldr = *ui->sliders.list[i];
+        const UIRect &r = ui->sliders.rect[i];
+        int x = thumbX(r, sldr.value);
+        int y = (r.h - SLIDER_BUTTON_SIZE) / 2;
+
+        uint16_t btnColor = (ui->sliders.pressed & (1UL << i)) ? sldr.buttonColorPressed : sldr.buttonColorNormal;
+        dst.fillRect(x, y, SLIDER_BUTTON_SIZE, SLIDER_BUTTON_SIZE, btnColor);
+        dst.drawRect(x, y, SLIDER_BUTTON_SIZE, SLIDER_BUTTON_SIZE, TFT_WHITE);
+
+        // Value is 0-100, so format it by hand rather than with sprintf
+        char buffer[4];
+        char *p = buffer + sizeof(buffer);
+        *--p = '\0';
+        int v = sldr.value;
+        do { *--p = '0' + v % 10; v /= 10; } while (v);
+
+        dst.setTextDatum(MC_DATUM);
+        dst.setTextColor(TFT_WHITE, btnColor);
+        dst.setTextFont(2);
+        dst.drawString(p, x + SLIDER_BUTTON_SIZE / 2, y + SLIDER_BUTTON_SIZE / 2);
+    }
+
+    static void draw(int i) {
+        if (!shown(i)) return;
+        UI_PROFILE_SCOPE(PROFILE_SLIDER);
+        const UIRect &r = ui->sliders.rect[i];
+
+        int y0, h;
+        TFT_eSPI &dst = surface(i);
+        dst.fillRect(0, 0, r.w, r.h, BACKGROUND_COLOR);
+        clearBand(dst, i, 0, r.w, y0, h);
+        drawThumb(dst, i);
+        closeSurface();
+        present(i, 0, 0, r.w, r.h);
+    }
+
+    // Delta redraw after the thumb moved from oldValue (or changed
+    // colour, when oldValue is the current value). Only the old and new
+    // thumb squares are repainted and pushed: as one strip when they
+    // overlap, as two squares when they don't. The sprite keeps the rest
+    // of the slider, so it always matches a full draw().
+    static void moveThumb(int i, int oldValue) {
+        if (!shown(i)) return;
+        UI_PROFILE_SCOPE(PROFILE_SLIDER);
+        const SliderSprite &sldr = *ui->sliders.list[i];
+        const UIRect &r = ui->sliders.rect[i];
+
+        int oldX = thumbX(r, oldValue);
+        int newX = thumbX(r, sldr.value);
+        int y0, h;
+        TFT_eSPI &dst = surface(i);
+        if (abs(newX - oldX) < SLIDER_BUTTON_SIZE) {
+            int x0 = min(oldX, newX);
+            int w = max(oldX, newX) + SLIDER_BUTTON_SIZE - x0;
+            clearBand(dst, i, x0, w, y0, h);
+            drawThumb(dst, i);
+            closeSurface();
+            present(i, x0, y0, w, h);
+        } else {
+            clearBand(dst, i, oldX, SLIDER_BUTTON_SIZE, y0, h);
+            drawThumb(dst, i);
+            closeSurface();
+            present(i, oldX, y0, SLIDER_BUTTON_SIZE, h);
+            present(i, newX, y0, SLIDER_BUTTON_SIZE, h);
+        }
+    }
+
+#ifndef MICRO_UI_FRAMEBUFFER
+    static void release(SliderSprite &sldr) {
+        sldr.sprite->~TFT_eSprite();    // Frees the pixel buffer
+        sldr.sprite = nullptr;
+    }
+#endif
+
+    static void drag(int i, int tx, int) {
+        SliderSprite &sldr = *ui->sliders.list[i];
+        const UIRect &r = ui->sliders.rect[i];
+        int range = r.w - SLIDER_BUTTON_SIZE;
+        int newValue = ((tx - r.x - SLIDER_BUTTON_SIZE / 2) * 100) / range;
+        newValue = constrain(newValue, 0, 100);
+
+        if (newValue != sldr.value) {
+            int oldValue = sldr.value;
+            sldr.value = newValue;
+#ifdef MICRO_UI_USE_SETTINGS
+            setSetting(sldr.setting, newValue);
+#endif
+            moveThumb(i, oldValue);
+        }
+    }
+
+    static void press(int i, int tx, int ty) {
+        ui->sliders.pressed |= 1UL << i;
+        drag(i, tx, ty);
+    }
+
+    static void lift(Handle handle) {
+        int i = find(handle);
+        if (i < 0) return;
+
+        SliderSprite &sldr = *ui->sliders.list[i];
+        ui->sliders.pressed &= ~(1UL << i);
+        moveThumb(i, sldr.value);
+
+        if (millis() - ui->touchStartTime >= BUTTON_DEBOUNCE_MS) post(EVENT_VALUE, i, sldr.value);
+    }
+
+    static int eventId(int i) { return ui->sliders.list[i]->id; }
+
+    static void fire(const UIEvent &event) {
+        if (event.type != EVENT_VALUE) return;
+        int i = find(handleOf(event));
+        if (i < 0) return;
+        SliderSprite &sldr = *ui->sliders.list[i];
+        void (*callback)(int) = sldr.callback;
+        UIEventCallback onEvent = sldr.onEvent;
+        void* context = sldr.context;
+
+        if (callback) callback(event.value);
+        if (onEvent) onEvent(event, context);
+    }
+};
+
+SliderHandle addSlider(int x, int y, int w, int h, int value, void (*callback)(int value), uint16_t trackColor = TFT_WHITE, uint16_t buttonColorNormal = TFT_BLUE, uint16_t buttonColorPressed = TFT_BLACK) {
+    int i = SliderWidget::add(SLIDER_BLOCK_SIZE, x, y, w, h);
+    if (i < 0) return SliderHandle();   // Error: arena or live list full
+
+    SliderSprite &sldr = *ui->sliders.list[i];
+    sldr.callback = callback;
+    sldr.trackColor = trackColor;
+    sldr.buttonColorNormal = buttonColorNormal;
+    sldr.buttonColorPressed = buttonColorPressed;
+    sldr.value = constrain(value, 0, 100);
+
+#ifndef MICRO_UI_FRAMEBUFFER
+    // Create sprite
+    sldr.sprite = new ((uint8_t*)&sldr + ARENA_ROUND(sizeof(SliderSprite))) TFT_eSprite(ui->panel);
+    sldr.sprite->setColorDepth(8);
+    sldr.sprite->createSprite(w, h);
+#endif
+
+    return SliderWidget::handleAt(i);
+}
+
+SliderHandle addSlider(int x, int y, int w, int h, int value, int id, UIEventCallback callback, void *context, uint16_t trackColor, uint16_t buttonColorNormal, uint16_t buttonColorPressed) {
+    SliderHandle handle = addSlider(x, y, w, h, value, nullptr, trackColor, buttonColorNormal, buttonColorPressed);
+    setCallback(handle, id, callback, context);
+    return handle;
+}
+
+void setCallback(SliderHandle handle, int id, UIEventCallback callback, void *context) {
+    int i = SliderWidget::find(handle);
+    if (i < 0) return;
+    SliderSprite &sldr = *ui->sliders.list[i];
+    sldr.onEvent = callback;
+    sldr.context = context;
+    sldr.id = id;
+}
+
+#ifdef MICRO_UI_USE_SETTINGS
+void bindSliderSetting(SliderHandle handle, SettingHandle setting) {
+    int i = SliderWidget::find(handle);
+    if (i < 0) return;
+    ui->sliders.list[i]->setting = setting;
+}
+#endif
+
+void drawSlider(SliderHandle handle) {
+    int i = SliderWidget::find(handle);
+    if (i >= 0) SliderWidget::draw(i);
+}
+
+void drawAllSliders() {
+    SliderWidget::drawAll();
+}
+
+void clearSlider(SliderHandle handle) {
+    int i = SliderWidget::find(handle);
+    if (i < 0) return;
+
+#ifdef MICRO_UI_FRAMEBUFFER
+    const UIRect &r = ui->sliders.rect[i];
+    ui->canvas->fillRect(r.x, r.y, r.w, r.h, BACKGROUND_COLOR);
+#else
+    ui->sliders.list[i]->sprite->fillSprite(BACKGROUND_COLOR);
+    ui->sliders.list[i]->sprite->pushSprite(ui->sliders.rect[i].x, ui->sliders.rect[i].y);
+#endif
+}
+
+void removeSlider(SliderHandle handle) {
+    int i = SliderWidget::find(handle);
+    if (i >= 0) SliderWidget::remove(i);
+}
+
+void removeAllSliders() {
+    SliderWidget::removeAll();
+}
+#endif
+
+#ifdef MICRO_UI_USE_LISTS
+// ===== List Handling =====
+// Content line v (pixels from the top of row 0) is shown at screen line
+// y + v - scrollY. With hardware scroll the list's band is the panel's
+// scroll area and line v always lives at frame memory line y + v % h;
+// moving the scroll start does the scrolling, so only rows coming into
+// view are drawn.
+#define LIST_BLOCK_SIZE     (ARENA_ROUND(sizeof(ScrollList)) + sizeof(TFT_eSprite))
+
+
+struct ListWidget : Widget<ListWidget, ScrollList, MAX_LISTS> {
+    static const UIWidgetKind kind = WIDGET_LIST;
+    static const bool touchable = true;
+    static Store& store() { return ui->lists; }
+
+    static int maxScroll(const ScrollList &lst, const UIRect &r) {
+        return max(0, lst.rowCount * lst.rowHeight - r.h);
+    }
+
+    // Rows past the end render blank.
+    static void renderRow(const ScrollList &lst, const UIRect &r, int row) {
+        uint16_t bg = row == lst.selected ? lst.selectColor : lst.bgColor;
+        lst.sprite->fillSprite(bg);
+        if (row >= lst.rowCount) return;
+
+        lst.sprite->setTextColor(lst.textColor, bg);
+        char cell[MAX_LIST_TEXT];
+        int cx = 0;
+        for (int c = 0; c < lst.columnCount; c++) {
+            int cw = lst.columnWidths ? lst.columnWidths[c] : r.w;
+            cell[0] = '\0';
+            lst.rowText(row, c, cell, sizeof(cell));
+
+            // Trim rather than spill into the next column
+            int len = strlen(cell);
+            while (len > 0 && lst.sprite->textWidth(cell) > cw - 4) cell[--len] = '\0';
+            lst.sprite->drawString(cell, cx + 2, lst.rowHeight / 2);
+            cx += cw;
+        }
+    }
+
+    // Sends content lines [from, to) of an already rendered row.
+    static void pushRowLines(const ScrollList &lst, const UIRect &r, int row, int from, int to) {
+        int top = row * lst.rowHeight;
+        while (from < to) {
+            int line, run;
+            if (lst.hardwareScroll) {
+                int m = from % r.h;
+                line = r.y + m;
+                run = min(to - from, r.h - m);  // Split where frame memory wraps
+            } else {
+                line = r.y + from - lst.scrollY;
+                run = to - from;
+            }
+            pushSpriteRect(*lst.sprite, r.x, line, 0, from - top, r.w, run);
+            from += run;
+        }
+    }
+
+    // Draws content lines [from, to), clipped to what is on screen.
+    static void drawLines(int i, int from, int to) {
+        const ScrollList &lst = *ui->lists.list[i];
+        const UIRect &r = ui->lists.rect[i];
+        from = max(from, lst.scrollY);
+        to = min(to, lst.scrollY + r.h);
+        if (from >= to) return;
+
+        UI_PROFILE_SCOPE(PROFILE_LIST);
+        for (int row = from / lst.rowHeight; row * lst.rowHeight < to; row++) {
+            int top = row * lst.rowHeight;
+            renderRow(lst, r, row);
+            pushRowLines(lst, r, row, max(from, top), min(to, top + lst.rowHeight));
+        }
+        UI_PROFILE_PIXELS(r.w * (to - from));
+    }
+
+    static void draw(int i) {
+        drawLines(i, ui->lists.list[i]->scrollY, ui->lists.list[i]->scrollY + ui->lists.rect[i].h);
+    }
+
+    static void drawRow(int i, int row) {
+        int rowHeight = ui->lists.list[i]->rowHeight;
+        drawLines(i, row * rowHeight, (row + 1) * rowHeight);
+    }
+
+    static void scrollTo(int i, int scrollY) {
+        ScrollList &lst = *ui->lists.list[i];
+        const UIRect &r = ui->lists.rect[i];
+        scrollY = constrain(scrollY, 0, maxScroll(lst, r));
+        int old = lst.scrollY;
+        if (scrollY == old) return;
+        lst.scrollY = scrollY;
+
+        if (!lst.hardwareScroll) {
+            draw(i);
+            return;
+        }
+        panelScrollStart(r.y + scrollY % r.h);
+        if (scrollY > old) {
+            drawLines(i, old + r.h, scrollY + r.h);     // Exposed at the bottom
+        } else {
+            drawLines(i, scrollY, old);                 // Exposed at the top
+        }
+    }
+
+    static void select(int i, int row) {
+        ScrollList &lst = *ui->lists.list[i];
+        int old = lst.selected;
+        lst.selected = row;
+        if (old >= 0 && old != row) drawRow(i, old);
+        if (row >= 0) drawRow(i, row);
+    }
+
+    static void release(ScrollList &lst) {
+        lst.sprite->~TFT_eSprite();     // Frees the row buffer
+        lst.sprite = nullptr;
+        if (lst.hardwareScroll) {
+            panelScrollArea(0, ui->height, 0);
+            panelScrollStart(0);
+        }
+    }
+
+    static void press(int i, int, int ty) {
+        ScrollList &lst = *ui->lists.list[i];
+        lst.pressY = ty;
+        lst.pressScrollY = lst.scrollY;
+        lst.dragging = false;
+    }
+
+    static void drag(int i, int, int ty) {
+        ScrollList &lst = *ui->lists.list[i];
+        int dy = lst.pressY - ty;
+        if (!lst.dragging && abs(dy) <= LIST_DRAG_SLOP) return;
+        lst.dragging = true;
+        scrollTo(i, lst.pressScrollY + dy);
+    }
+
+    static void lift(Handle handle) {
+        int i = find(handle);
+        if (i < 0) return;
+        ScrollList &lst = *ui->lists.list[i];
+        if (lst.dragging || millis() - ui->touchStartTime < BUTTON_DEBOUNCE_MS) return;
+
+        int row = (lst.pressY - ui->lists.rect[i].y + lst.scrollY) / lst.rowHeight;
+        if (row >= lst.rowCount) return;
+        select(i, row);
+        post(EVENT_SELECT, i, row);
+    }
+
+    static int eventId(int i) { return ui->lists.list[i]->id; }
+
+    static void fire(const UIEvent &event) {
+        if (event.type != EVENT_SELECT) return;
+        int i = find(handleOf(event));
+        if (i < 0) return;
+        // Either callback may switch screens; the list is not touched after
+        ScrollList &lst = *ui->lists.list[i];
+        void (*callback)(int) = lst.callback;
+        UIEventCallback onEvent = lst.onEvent;
+        void* context = lst.context;
+
+        if (callback) callback(event.value);
+        if (onEvent) onEvent(event, context);
+    }
+};
+
+ListHandle addList(int x, int y, int w, int h, int rowCount, void (*rowText)(int row, int column, char* out, size_t len), void (*callback)(int row), uint8_t fontCode, uint16_t textColor, uint16_t bgColor, uint16_t selectColor) {
+    if (!rowText) return ListHandle();
+
+    // Clip to screen; lists also work in portrait, so ask the panel
+    if (x + w > ui->width) w = ui->width - x;
+    if (y + h > ui->height) h = ui->height - y;
+    if (w <= 0 || h <= 0) return ListHandle();
+
+    // The scroll registers move whole panel lines, so only a full-width
+    // list in native rotation can use them, and only one at a time. The
+    // frame, when there is one, is pushed as drawn and cannot follow.
+    bool hardwareScroll = ui->rotation == 0 && x == 0 && w == ui->width && ui->canvas == ui->panel;
+    for (int j = 0; j < ui->lists.count; j++) {
+        if (ui->lists.list[j]->hardwareScroll) hardwareScroll = false;
+    }
+
+    int i = ListWidget::add(LIST_BLOCK_SIZE, x, y, w, h);
+    if (i < 0) return ListHandle();     // Error: arena or live list full
+
+    ScrollList &lst = *ui->lists.list[i];
+    lst.rowText = rowText;
+    lst.callback = callback;
+    lst.textColor = textColor;
+    lst.bgColor = bgColor;
+    lst.selectColor = selectColor;
+    lst.fontCode = fontCode;
+    lst.columnCount = 1;
+    lst.rowCount = max(rowCount, 0);
+    lst.selected = -1;
+
+    // One row of pixels, whatever rowCount is
+    lst.sprite = new ((uint8_t*)&lst + ARENA_ROUND(sizeof(ScrollList))) TFT_eSprite(ui->panel);
+    lst.rowHeight = lst.sprite->fontHeight(fontCode) + 4;
+    lst.sprite->setColorDepth(SPRITE_DEPTH);
+    lst.sprite->createSprite(w, lst.rowHeight);
+    lst.sprite->setTextFont(fontCode);
+    lst.sprite->setTextDatum(ML_DATUM);
+
+    if (hardwareScroll) {
+        lst.hardwareScroll = true;
+        panelScrollArea(y, h, ui->height - y - h);
+        panelScrollStart(y);
+    }
+    return ListWidget::handleAt(i);
 }
 
-void updateButton(ButtonHandle handle, const char* newLabel, uint16_t bgNormal, uint16_t bgPressed) {
-    if (handle.index < 0 || handle.index >= MAX_BUTTONS) return;
-    SimpleButton &btn = buttonList[handle.index];
-    if (!btn.inUse || btn.generation != handle.generation) return;
-    btn.bgNormal = bgNormal;
-    btn.bgPressed = bgPressed;
-    updateButton(handle, newLabel);
+void setCallback(ListHandle handle, int id, UIEventCallback callback, void *context) {
+    int i = ListWidget::find(handle);
+    if (i < 0) return;
+    ScrollList &lst = *ui->lists.list[i];
+    lst.onEvent = callback;
+    lst.context = context;
+    lst.id = id;
 }
 
-void updateButton(ButtonHandle handle, const char* newLabel, uint16_t bgNormal) {
-    if (handle.index < 0 || handle.index >= MAX_BUTTONS) return;
-    SimpleButton &btn = buttonList[handle.index];
-    if (!btn.inUse || btn.generation != handle.generation) return;
-    btn.bgNormal = bgNormal;
-    updateButton(handle, newLabel);
+void setListColumns(ListHandle handle, const uint8_t* widths, uint8_t count) {
+    int i = ListWidget::find(handle);
+    if (i < 0) return;
+    ScrollList &lst = *ui->lists.list[i];
+    lst.columnWidths = widths;
+    lst.columnCount = (widths && count) ? count : 1;
+    ListWidget::draw(i);
 }
 
-void updateButton(ButtonHandle handle, const char* newLabel) {
-    if (handle.index < 0 || handle.index >= MAX_BUTTONS) return;
-    SimpleButton &btn = buttonList[handle.index];
-    if (!btn.inUse || btn.generation != handle.generation) return;
-    safeCopy(btn.label, newLabel, MAX_BUTTON_TEXT);
-    drawButton(btn);
+// Appending to a log only draws the new rows, and only if they show.
+void setListRowCount(ListHandle handle, int rowCount) {
+    int i = ListWidget::find(handle);
+    if (i < 0) return;
+    ScrollList &lst = *ui->lists.list[i];
+    int old = lst.rowCount;
+    lst.rowCount = max(rowCount, 0);
+    if (lst.selected >= lst.rowCount) lst.selected = -1;
+
+    ListWidget::scrollTo(i, lst.scrollY);   // Clamps if the list shrank
+    ListWidget::drawLines(i, min(old, lst.rowCount) * lst.rowHeight, max(old, lst.rowCount) * lst.rowHeight);
 }
 
-void drawButton(const SimpleButton &btn) {
-    if (!btn.visible) 
-        return;
-    uint16_t bgColor = btn.pressed ? btn.bgPressed : btn.bgNormal;
-    tft.fillRect(btn.x, btn.y, btn.w, btn.h, bgColor);
-    tft.drawRect(btn.x, btn.y, btn.w, btn.h, TFT_WHITE);
-    tft.setTextColor(TFT_WHITE, bgColor);
-    tft.setTextFont(btn.fontCode);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString(btn.label, btn.x + btn.w / 2, btn.y + btn.h / 2 + 2);
+void updateListRow(ListHandle handle, int row) {
+    int i = ListWidget::find(handle);
+    if (i >= 0) ListWidget::drawRow(i, row);
 }
 
-void drawAllButtons() {
-    for (int i = 0; i < MAX_BUTTONS; i++) {
-        if (buttonList[i].inUse) drawButton(buttonList[i]);
-    }
+void scrollList(ListHandle handle, int pixels) {
+    int i = ListWidget::find(handle);
+    if (i >= 0) ListWidget::scrollTo(i, ui->lists.list[i]->scrollY + pixels);
 }
 
-void clearButton(ButtonHandle handle) {
-    if (handle.index < 0 || handle.index >= MAX_BUTTONS) return;
-    SimpleButton &btn = buttonList[handle.index];
-    if (!btn.inUse || btn.generation != handle.generation) return;
-    tft.fillRect(btn.x, btn.y, btn.w, btn.h, BACKGROUND_COLOR);
-    tft.drawRect(btn.x, btn.y, btn.w, btn.h, TFT_WHITE);
+// Puts `row` at the top, or as near as the end of the list allows.
+void scrollListTo(ListHandle handle, int row) {
+    int i = ListWidget::find(handle);
+    if (i >= 0) ListWidget::scrollTo(i, row * ui->lists.list[i]->rowHeight);
 }
 
-void removeButton(ButtonHandle handle) {
-    if (handle.index < 0 || handle.index >= MAX_BUTTONS) return;
-    SimpleButton &btn = buttonList[handle.index];
-    if (!btn.inUse || btn.generation != handle.generation) return;
-    btn.inUse = false;
+int getListSelection(ListHandle handle) {
+    int i = ListWidget::find(handle);
+    return i >= 0 ? ui->lists.list[i]->selected : -1;
 }
 
-void removeAllButtons() {
-    for (int i = 0; i < MAX_BUTTONS; i++) buttonList[i].inUse = false;
+void drawList(ListHandle handle) {
+    int i = ListWidget::find(handle);
+    if (i >= 0) ListWidget::draw(i);
 }
 
-void handleTouchButtons(int tx, int ty) {
-    if (currentButtonIndex != -1) return;
+void drawAllLists() {
+    ListWidget::drawAll();
+}
 
-    for (int i = 0; i < MAX_BUTTONS; i++) {
-        SimpleButton &btn = buttonList[i];
-        if (!btn.inUse || !btn.visible) continue;
+void removeList(ListHandle handle) {
+    int i = ListWidget::find(handle);
+    if (i >= 0) ListWidget::remove(i);
+}
 
-        if (tx >= btn.x && tx <= (btn.x + btn.w) &&
-            ty >= btn.y && ty <= (btn.y + btn.h)) {
-            currentButtonIndex = i;
-            touchStartTime = millis();
-            btn.pressed = true;
-            drawButton(btn);
-            break;
-        }
-    }
+void removeAllLists() {
+    ListWidget::removeAll();
 }
+#endif
+
+#ifdef MICRO_UI_USE_CHARTS
+// ===== Chart Handling =====
+// Block layout: TrendChart, its column sprite object, then the span
+// history. Columns map 1:1 to screen columns; an empty span has
+// min > max.
+#define CHART_BLOCK_SIZE(w, series) \
+    (ARENA_ROUND(sizeof(TrendChart)) + ARENA_ROUND(sizeof(TFT_eSprite)) + (size_t)(w) * (series) * 2)
+#define CHART_EMPTY_MIN     255
+#define CHART_EMPTY_MAX     0
+
 
-void releaseActiveButton() {
-    if (currentButtonIndex == -1) return;
+struct ChartWidget : Widget<ChartWidget, TrendChart, MAX_CHARTS> {
+    static const UIWidgetKind kind = WIDGET_CHART;
+    static const bool fixedSize = false;    // Blocks grow with width and series
+    static Store& store() { return ui->charts; }
 
-    int i = currentButtonIndex;
-    currentButtonIndex = -1;
+    static uint8_t* columnSpans(const TrendChart &chart, int column) {
+        return chart.spans + column * chart.seriesCount * 2;
+    }
 
-    if (buttonList[i].inUse && (millis() - touchStartTime >= BUTTON_DEBOUNCE_MS)) {
-        if (buttonList[i].callback) {
-            buttonList[i].callback(buttonList[i].label);
+    static void clearColumn(const TrendChart &chart, int column) {
+        uint8_t* span = columnSpans(chart, column);
+        for (int s = 0; s < chart.seriesCount; s++) {
+            span[2 * s] = CHART_EMPTY_MIN;
+            span[2 * s + 1] = CHART_EMPTY_MAX;
         }
     }
 
-    if (buttonList[i].inUse) {
-        buttonList[i].pressed = false;
-        drawButton(buttonList[i]);
+    // Top row is maxValue; out of range values stick to the edge.
+    static uint8_t valueRow(const TrendChart &chart, int h, float value) {
+        float t = (value - chart.minValue) / (chart.maxValue - chart.minValue);
+        int row = (h - 1) - (int)lroundf(t * (h - 1));
+        return constrain(row, 0, h - 1);
     }
-}
-#endif
 
+    static void drawColumn(int i, int column) {
+        const TrendChart &chart = *ui->charts.list[i];
+        const UIRect &r = ui->charts.rect[i];
+        chart.sprite->fillSprite(chart.bgColor);
+        for (int g = 1; g < CHART_GRID_LINES; g++) {
+            chart.sprite->drawPixel(0, g * (r.h - 1) / CHART_GRID_LINES, chart.gridColor);
+        }
+        const uint8_t* span = columnSpans(chart, column);
+        for (int s = 0; s < chart.seriesCount; s++) {
+            if (span[2 * s] > span[2 * s + 1]) continue;
+            chart.sprite->drawFastVLine(0, span[2 * s], span[2 * s + 1] - span[2 * s] + 1, chart.seriesColor[s]);
+        }
+        pushSpriteRect(*chart.sprite, r.x + column, r.y, 0, 0, 1, r.h);
+    }
 
-#ifdef MICRO_UI_USE_LABELS
-// ===== Label Handling =====
-LabelSprite     labelList [MAX_LABELS];
+    static void draw(int i) {
+        UI_PROFILE_SCOPE(PROFILE_CHART);
+        const UIRect &r = ui->charts.rect[i];
+        for (int column = 0; column < r.w; column++) drawColumn(i, column);
+        UI_PROFILE_PIXELS(r.w * r.h);
+    }
 
-LabelHandle addLabel(int x, int y, const char* text, uint8_t fontCode, uint16_t textColor, uint16_t bgColor) {
-    for (int i = 0; i < MAX_LABELS; i++) {
-        if (!labelList[i].inUse) {
-            LabelSprite &lbl = labelList[i];
-            safeCopy(lbl.lastText, text, MAX_LABEL_TEXT);
-            lbl.visible = true;
-            lbl.fontCode = fontCode;
-            lbl.textColor = textColor;
-            lbl.bgColor = bgColor;
-
-            // Temporary sprite to measure text
-            TFT_eSprite temp(&tft);
-            temp.setColorDepth(8);
-            temp.createSprite(1, 1);
-            temp.setTextFont(fontCode);
-            temp.setTextDatum(MC_DATUM);
-
-            int w = temp.textWidth(text) + 10;
-            int h = temp.fontHeight() + 4;
-
-            // Clip width/height to screen
-            if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
-            if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
-
-            // Fallback if it's still out of bounds
-            if (w <= 0 || h <= 0) break;
-
-            lbl.x = x;
-            lbl.y = y;
-            lbl.w = w;
-            lbl.h = h;
-
-            lbl.sprite = new TFT_eSprite(&tft);
-            lbl.sprite->setColorDepth(8);
-            lbl.sprite->createSprite(w, h);
-            lbl.sprite->fillSprite(bgColor);
-            lbl.sprite->setTextColor(textColor, bgColor);
-            lbl.sprite->setTextFont(fontCode);
-            lbl.sprite->setTextDatum(MC_DATUM);
-            lbl.sprite->drawString(text, w / 2, h / 2);
-            lbl.sprite->pushSprite(x, y);
+    static void reset(TrendChart &chart, int w) {
+        for (int column = 0; column < w; column++) clearColumn(chart, column);
+        chart.head = 0;
+        chart.pending = 0;
+        chart.hasLast = false;
+    }
 
-            lbl.generation++;
-            lbl.inUse = true;
+    static void push(int i, const float* values) {
+        TrendChart &chart = *ui->charts.list[i];
+        const UIRect &r = ui->charts.rect[i];
+        if (chart.pending == 0) clearColumn(chart, chart.head);
+
+        // Fold the sample, joined to the previous one, into the head span
+        uint8_t* span = columnSpans(chart, chart.head);
+        bool grew = false;
+        for (int s = 0; s < chart.seriesCount; s++) {
+            uint8_t row = valueRow(chart, r.h, values[s]);
+            uint8_t lo = chart.hasLast ? min(row, chart.lastRow[s]) : row;
+            uint8_t hi = chart.hasLast ? max(row, chart.lastRow[s]) : row;
+            chart.lastRow[s] = row;
+            if (lo < span[2 * s]) { span[2 * s] = lo; grew = true; }
+            if (hi > span[2 * s + 1]) { span[2 * s + 1] = hi; grew = true; }
+        }
+        chart.hasLast = true;
 
-            LabelHandle result;
-            result.index = i;
-            result.generation = lbl.generation;
-            return result;
+        if (grew) {
+            UI_PROFILE_SCOPE(PROFILE_CHART);
+            drawColumn(i, chart.head);
+            UI_PROFILE_PIXELS(r.h);
+        }
+        if (++chart.pending < chart.samplesPerColumn) return;
+
+        // Column complete: sweep on and open the gap one column further
+        chart.pending = 0;
+        chart.head = (chart.head + 1) % r.w;
+        if (CHART_SWEEP_GAP > 0 && CHART_SWEEP_GAP < r.w) {
+            UI_PROFILE_SCOPE(PROFILE_CHART);
+            int gap = (chart.head + CHART_SWEEP_GAP - 1) % r.w;
+            clearColumn(chart, gap);
+            drawColumn(i, gap);
+            UI_PROFILE_PIXELS(r.h);
         }
     }
 
-    // Failure fallback
-    LabelHandle errorHandle;
-    errorHandle.index = -1;
-    errorHandle.generation = 0;
-    return errorHandle;
+    static void release(TrendChart &chart) {
+        chart.sprite->~TFT_eSprite();   // Frees the column buffer
+        chart.sprite = nullptr;
+    }
+};
+
+ChartHandle addChart(int x, int y, int w, int h, uint8_t seriesCount, float minValue, float maxValue, uint16_t samplesPerColumn, uint16_t bgColor, uint16_t gridColor) {
+    if (seriesCount < 1 || seriesCount > CHART_MAX_SERIES || !(maxValue > minValue)) return ChartHandle();
+
+    // Clip to screen; rows are stored as bytes
+    if (x + w > ui->width) w = ui->width - x;
+    if (y + h > ui->height) h = ui->height - y;
+    if (h > 255) h = 255;
+    if (w <= 0 || h <= 1) return ChartHandle();
+
+    int i = ChartWidget::add(CHART_BLOCK_SIZE(w, seriesCount), x, y, w, h);
+    if (i < 0) return ChartHandle();    // Error: arena or live list full
+
+    static const uint16_t defaultColors[] = { TFT_LIGHTGREY, TFT_GREEN, TFT_YELLOW };
+    TrendChart &chart = *ui->charts.list[i];
+    uint8_t* block = (uint8_t*)&chart;
+    chart.spans = block + ARENA_ROUND(sizeof(TrendChart)) + ARENA_ROUND(sizeof(TFT_eSprite));
+    chart.minValue = minValue;
+    chart.maxValue = maxValue;
+    for (int s = 0; s < CHART_MAX_SERIES; s++) chart.seriesColor[s] = defaultColors[s % 3];
+    chart.bgColor = bgColor;
+    chart.gridColor = gridColor;
+    chart.samplesPerColumn = max(samplesPerColumn, (uint16_t)1);
+    chart.seriesCount = seriesCount;
+    ChartWidget::reset(chart, w);
+
+    chart.sprite = new (block + ARENA_ROUND(sizeof(TrendChart))) TFT_eSprite(ui->panel);
+    chart.sprite->setColorDepth(16);    // Only h pixels, so keep exact series colours
+    chart.sprite->createSprite(1, h);
+
+    return ChartWidget::handleAt(i);
 }
 
-void updateLabel(LabelHandle handle, const char* text) {
-    if (handle.index < 0 || handle.index >= MAX_LABELS) return;
-    LabelSprite &lbl = labelList[handle.index];
-    updateLabel(handle, text, lbl.textColor, lbl.bgColor);
+// Takes effect from the next column drawn; drawChart() repaints it all.
+void setChartSeriesColor(ChartHandle handle, uint8_t series, uint16_t color) {
+    int i = ChartWidget::find(handle);
+    if (i < 0 || series >= CHART_MAX_SERIES) return;
+    ui->charts.list[i]->seriesColor[series] = color;
 }
 
-void updateLabel(LabelHandle handle, const char* text, uint16_t textColor) {
-    if (handle.index < 0 || handle.index >= MAX_LABELS) return;
-    LabelSprite &lbl = labelList[handle.index];
-    lbl.textColor = textColor;
-    updateLabel(handle, text, textColor, lbl.bgColor);
+// History is kept as screen rows, so a new range starts the chart over.
+void setChartRange(ChartHandle handle, float minValue, float maxValue) {
+    int i = ChartWidget::find(handle);
+    if (i < 0 || !(maxValue > minValue)) return;
+    ui->charts.list[i]->minValue = minValue;
+    ui->charts.list[i]->maxValue = maxValue;
+    clearChart(handle);
 }
 
-void updateLabel(LabelHandle handle, const char* text, uint16_t textColor, uint16_t bgColor) {
-    if (handle.index < 0 || handle.index >= MAX_LABELS) return;
-    LabelSprite &lbl = labelList[handle.index];
-    if (!lbl.inUse || lbl.generation != handle.generation) return;
+void chartPush(ChartHandle handle, const float* values) {
+    int i = ChartWidget::find(handle);
+    if (i >= 0) ChartWidget::push(i, values);
+}
 
-    if (strncmp(lbl.lastText, text, MAX_LABEL_TEXT) != 0) {
-        // Create temp sprite to measure new size
-        TFT_eSprite temp(&tft);
-        temp.setColorDepth(8);
-        temp.createSprite(1, 1); // Placeholder
-        temp.setTextFont(lbl.fontCode);
-        temp.setTextDatum(MC_DATUM);
-        int newW = temp.textWidth(text) + 10;
-        int newH = temp.fontHeight() + 4;
-        temp.deleteSprite();
+void chartPush(ChartHandle handle, float value) {
+    float values[CHART_MAX_SERIES];
+    for (float &v : values) v = value;
+    chartPush(handle, values);
+}
 
-        // Clip to screen bounds
-        if (lbl.x + newW > SCREEN_WIDTH) newW = SCREEN_WIDTH - lbl.x;
-        if (lbl.y + newH > SCREEN_HEIGHT) newH = SCREEN_HEIGHT - lbl.y;
+void clearChart(ChartHandle handle) {
+    int i = ChartWidget::find(handle);
+    if (i < 0) return;
+    ChartWidget::reset(*ui->charts.list[i], ui->charts.rect[i].w);
+    ChartWidget::draw(i);
+}
 
-        // Save previous size for cleanup
-        int prevW = lbl.w;
-        int prevH = lbl.h;
+void drawChart(ChartHandle handle) {
+    int i = ChartWidget::find(handle);
+    if (i >= 0) ChartWidget::draw(i);
+}
 
-        // Resize sprite if needed
-        if (newW != lbl.w || newH != lbl.h) {
-            lbl.w = newW;
-            lbl.h = newH;
+void drawAllCharts() {
+    ChartWidget::drawAll();
+}
 
-            if (lbl.sprite) {
-                delete lbl.sprite;
-                lbl.sprite = nullptr;
-            }
-            lbl.sprite = new TFT_eSprite(&tft);
-            lbl.sprite->setColorDepth(8);
-            lbl.sprite->createSprite(lbl.w, lbl.h);
-            lbl.sprite->setTextFont(lbl.fontCode);
-            lbl.sprite->setTextDatum(MC_DATUM);
-        }
+void removeChart(ChartHandle handle) {
+    int i = ChartWidget::find(handle);
+    if (i >= 0) ChartWidget::remove(i);
+}
 
-        // Set colors and draw
-        lbl.textColor = textColor;
-        lbl.bgColor = bgColor;
-        lbl.sprite->setTextColor(textColor, bgColor);
-        lbl.sprite->fillSprite(bgColor);
-        lbl.sprite->drawString(text, lbl.w / 2, lbl.h / 2);
-        lbl.sprite->pushSprite(lbl.x, lbl.y);
+void removeAllCharts() {
+    ChartWidget::removeAll();
+}
+#endif
 
-        // Clear leftover area from previous larger label
-        if (prevW > lbl.w) {
-            int dx = prevW - lbl.w;
-            tft.fillRect(lbl.x + lbl.w, lbl.y, dx, lbl.h, bgColor);
-        }
-        if (prevH > lbl.h) {
-            int dy = prevH - lbl.h;
-            tft.fillRect(lbl.x, lbl.y + lbl.h, lbl.w, dy, bgColor);
-        }
+#ifdef MICRO_UI_USE_PROGRESS
+// ===== Progress Bar Handling =====
 
-        // Track last label
-        safeCopy(lbl.lastText, text, MAX_LABEL_TEXT);
+struct ProgressWidget : Widget<ProgressWidget, ProgressBar, MAX_PROGRESS_BARS> {
+    static const UIWidgetKind kind = WIDGET_PROGRESS;
+    static Store& store() { return ui->progressBars; }
+
+    // Fill edge in inner-area pixels
+    static int fillWidth(const UIRect &r, int value) {
+        return ((r.w - 2) * value) / 100;
+    }
+
+    static void draw(int i) {
+        UI_PROFILE_SCOPE(PROFILE_PROGRESS);
+        const ProgressBar &bar = *ui->progressBars.list[i];
+        const UIRect &r = ui->progressBars.rect[i];
+        int innerW = r.w - 2;
+        int fillW = fillWidth(r, bar.value);
+        ui->canvas->drawRect(r.x, r.y, r.w, r.h, bar.borderColor);
+        if (fillW > 0) ui->canvas->fillRect(r.x + 1, r.y + 1, fillW, r.h - 2, bar.fillColor);
+        if (fillW < innerW) ui->canvas->fillRect(r.x + 1 + fillW, r.y + 1, innerW - fillW, r.h - 2, bar.bgColor);
+        UI_PROFILE_PIXELS(r.w * r.h);
     }
+
+    static void set(int i, int value) {
+        ProgressBar &bar = *ui->progressBars.list[i];
+        const UIRect &r = ui->progressBars.rect[i];
+        value = constrain(value, 0, 100);
+        int oldW = fillWidth(r, bar.value);
+        int newW = fillWidth(r, value);
+        bar.value = value;
+        if (newW == oldW) return;
+
+        UI_PROFILE_SCOPE(PROFILE_PROGRESS);
+        int from = min(oldW, newW);
+        int width = abs(newW - oldW);
+        ui->canvas->fillRect(r.x + 1 + from, r.y + 1, width, r.h - 2, newW > oldW ? bar.fillColor : bar.bgColor);
+        UI_PROFILE_PIXELS(width * (r.h - 2));
+    }
+};
+
+ProgressHandle addProgressBar(int x, int y, int w, int h, int value, uint16_t fillColor, uint16_t bgColor, uint16_t borderColor) {
+    if (w < 3 || h < 3) return ProgressHandle();
+    int i = ProgressWidget::add(sizeof(ProgressBar), x, y, w, h);
+    if (i < 0) return ProgressHandle(); // Error: arena or live list full
+
+    ProgressBar &bar = *ui->progressBars.list[i];
+    bar.fillColor = fillColor;
+    bar.bgColor = bgColor;
+    bar.borderColor = borderColor;
+    bar.value = constrain(value, 0, 100);
+    return ProgressWidget::handleAt(i);
 }
 
-void clearLabel(LabelHandle handle) {
-    if (handle.index < 0 || handle.index >= MAX_LABELS) return;
-    LabelSprite &lbl = labelList[handle.index];
-    if (!lbl.inUse || lbl.generation != handle.generation || !lbl.sprite) return;
-    lbl.sprite->fillSprite(lbl.bgColor);
-    lbl.sprite->pushSprite(lbl.x, lbl.y);
+void setProgress(ProgressHandle handle, int value) {
+    int i = ProgressWidget::find(handle);
+    if (i >= 0) ProgressWidget::set(i, value);
 }
 
-void removeLabel(LabelHandle handle) {
-    if (handle.index < 0 || handle.index >= MAX_LABELS) return;
-    LabelSprite &lbl = labelList[handle.index];
-    if (!lbl.inUse || lbl.generation != handle.generation) return;
-    if (lbl.sprite) {
-        delete lbl.sprite;
-        lbl.sprite = nullptr;
-    }
-    lbl.inUse = false;
+void drawProgress(ProgressHandle handle) {
+    int i = ProgressWidget::find(handle);
+    if (i >= 0) ProgressWidget::draw(i);
 }
 
-void removeAllLabels() {
-    for (int i = 0; i < MAX_LABELS; i++) {
-        if (labelList[i].inUse) {
-            if (labelList[i].sprite) {
-                delete labelList[i].sprite;
-                labelList[i].sprite = nullptr;
-            }
-            labelList[i].inUse = false;
-        }
-    }
+void drawAllProgressBars() {
+    ProgressWidget::drawAll();
 }
-#endif
 
-#ifdef MICRO_UI_USE_SLIDERS
-// ===== Slider Functions =====
-SliderSprite    sliderList[MAX_SLIDERS];
-int             currentSliderIndex  = -1;
+void removeProgressBar(ProgressHandle handle) {
+    int i = ProgressWidget::find(handle);
+    if (i >= 0) ProgressWidget::remove(i);
+}
 
-SliderHandle addSlider(int x, int y, int w, int h, int value, void (*callback)(int value), uint16_t trackColor = TFT_WHITE, uint16_t buttonColorNormal = TFT_BLUE, uint16_t buttonColorPressed = TFT_BLACK) {
-    for (int i = 0; i < MAX_SLIDERS; i++) {
-        if (!sliderList[i].inUse) {
-            SliderSprite &sldr = sliderList[i];
-            sldr.x = x;
-            sldr.y = y;
-            sldr.w = w;
-            sldr.h = h;
-            sldr.callback = callback;
-            sldr.trackColor = trackColor;
-            sldr.buttonColorNormal = buttonColorNormal;
-            sldr.buttonColorPressed = buttonColorPressed;
-            sldr.visible = true;
-            sldr.pressed = false;
-            sldr.value = constrain(value, 0, 100);
-            sldr.generation++;
-            sldr.inUse = true;
-
-            // Create sprite
-            sldr.sprite = new TFT_eSprite(&tft);
-            sldr.sprite->setColorDepth(8);
-            sldr.sprite->createSprite(w, h);
-
-            // Return handle
-            SliderHandle result;
-            result.index = i;
-            result.generation = sldr.generation;
-            return result;
-        }
-    }
-
-    // Failed to allocate
-    SliderHandle result;
-    result.index = -1;
-    result.generation = 0;
-    return result;
+void removeAllProgressBars() {
+    ProgressWidget::removeAll();
 }
+#endif
 
-void drawSlider(const SliderSprite &sldr) {
-    if (!sldr.visible || !sldr.sprite) return;
+#ifdef MICRO_UI_USE_GAUGES
+// ===== Gauge Handling =====
 
-    int range = sldr.w - SLIDER_BUTTON_SIZE;
-    int thumbX = (sldr.value * range) / 100;
-    int thumbY = (sldr.h - SLIDER_BUTTON_SIZE) / 2;
+static uint32_t fillArcSpans(int cx, int cy, int radius, int thickness, float startAngle, float endAngle, uint16_t color);
 
-    sldr.sprite->fillSprite(BACKGROUND_COLOR);
+struct GaugeWidget : Widget<GaugeWidget, ArcGauge, MAX_GAUGES> {
+    static const UIWidgetKind kind = WIDGET_GAUGE;
+    static Store& store() { return ui->gauges; }
 
-    // Draw track
-    int trackY = (sldr.h - SLIDER_TRACK_THICKNESS) / 2;
-    sldr.sprite->fillRect(0, trackY, sldr.w, SLIDER_TRACK_THICKNESS, sldr.trackColor);
+    static float valueAngle(const ArcGauge &gauge, int value) {
+        return gauge.startAngle + (gauge.endAngle - gauge.startAngle) * value / 100.0f;
+    }
 
-    // Draw thumb button
-    uint16_t btnColor = sldr.pressed ? sldr.buttonColorPressed : sldr.buttonColorNormal;
-    sldr.sprite->fillRect(thumbX, thumbY, SLIDER_BUTTON_SIZE, SLIDER_BUTTON_SIZE, btnColor);
-    sldr.sprite->drawRect(thumbX, thumbY, SLIDER_BUTTON_SIZE, SLIDER_BUTTON_SIZE, TFT_WHITE);
+    static void draw(int i) {
+        UI_PROFILE_SCOPE(PROFILE_GAUGE);
+        const ArcGauge &gauge = *ui->gauges.list[i];
+        const UIRect &r = ui->gauges.rect[i];
+        int radius = r.w / 2;
+        float split = valueAngle(gauge, gauge.value);
+        uint32_t pixels = fillArcSpans(r.x + radius, r.y + radius, radius, gauge.thickness, gauge.startAngle, split, gauge.fillColor);
+        pixels += fillArcSpans(r.x + radius, r.y + radius, radius, gauge.thickness, split, gauge.endAngle, gauge.trackColor);
+        UI_PROFILE_PIXELS(pixels);
+        (void)pixels;
+    }
 
-    // Draw text centered inside thumb
-    char buffer[6];
-    sprintf(buffer, "%d", sldr.value);
-    sldr.sprite->setTextDatum(MC_DATUM);
-    sldr.sprite->setTextColor(TFT_WHITE, btnColor);
-    sldr.sprite->setTextFont(2);
-    sldr.sprite->drawString(buffer, thumbX + SLIDER_BUTTON_SIZE / 2, thumbY + SLIDER_BUTTON_SIZE / 2);
+    // Only the sector between the old and new value changes colour.
+    static void set(int i, int value) {
+        ArcGauge &gauge = *ui->gauges.list[i];
+        const UIRect &r = ui->gauges.rect[i];
+        value = constrain(value, 0, 100);
+        int old = gauge.value;
+        gauge.value = value;
+        if (value == old) return;
+
+        UI_PROFILE_SCOPE(PROFILE_GAUGE);
+        int radius = r.w / 2;
+        float from = valueAngle(gauge, min(old, value));
+        float to = valueAngle(gauge, max(old, value));
+        uint32_t pixels = fillArcSpans(r.x + radius, r.y + radius, radius, gauge.thickness, from, to,
+                                       value > old ? gauge.fillColor : gauge.trackColor);
+        UI_PROFILE_PIXELS(pixels);
+        (void)pixels;
+    }
+};
 
-    // Push to screen
-    sldr.sprite->pushSprite(sldr.x, sldr.y);
+GaugeHandle addGauge(int cx, int cy, int radius, int thickness, int value, uint16_t fillColor, uint16_t trackColor, int16_t startAngle, int16_t endAngle) {
+    if (radius < 1 || thickness < 1 || endAngle <= startAngle || endAngle - startAngle > 360) return GaugeHandle();
+    int i = GaugeWidget::add(sizeof(ArcGauge), cx - radius, cy - radius, 2 * radius + 1, 2 * radius + 1);
+    if (i < 0) return GaugeHandle();    // Error: arena or live list full
+
+    ArcGauge &gauge = *ui->gauges.list[i];
+    gauge.fillColor = fillColor;
+    gauge.trackColor = trackColor;
+    gauge.startAngle = startAngle;
+    gauge.endAngle = endAngle;
+    gauge.thickness = min(thickness, radius + 1);
+    gauge.value = constrain(value, 0, 100);
+    return GaugeWidget::handleAt(i);
 }
 
+void setGauge(GaugeHandle handle, int value) {
+    int i = GaugeWidget::find(handle);
+    if (i >= 0) GaugeWidget::set(i, value);
+}
 
-void drawAllSliders() {
-    for (int i = 0; i < MAX_SLIDERS; i++) {
-        if (sliderList[i].inUse) drawSlider(sliderList[i]);
-    }
+void drawGauge(GaugeHandle handle) {
+    int i = GaugeWidget::find(handle);
+    if (i >= 0) GaugeWidget::draw(i);
 }
 
-void clearSlider(SliderHandle handle) {
-    if (handle.index < 0 || handle.index >= MAX_SLIDERS) return;
-    SliderSprite &sldr = sliderList[handle.index];
-    if (!sldr.inUse || sldr.generation != handle.generation || !sldr.sprite) return;
+void drawAllGauges() {
+    GaugeWidget::drawAll();
+}
 
-    sldr.sprite->fillSprite(BACKGROUND_COLOR);
-    sldr.sprite->pushSprite(sldr.x, sldr.y);
+void removeGauge(GaugeHandle handle) {
+    int i = GaugeWidget::find(handle);
+    if (i >= 0) GaugeWidget::remove(i);
 }
 
-void removeSlider(SliderHandle handle) {
-    if (handle.index < 0 || handle.index >= MAX_SLIDERS) return;
-    SliderSprite &sldr = sliderList[handle.index];
-    if (!sldr.inUse || sldr.generation != handle.generation) return;
+void removeAllGauges() {
+    GaugeWidget::removeAll();
+}
+#endif
 
-    if (sldr.sprite) {
-        delete sldr.sprite;
-        sldr.sprite = nullptr;
+#if defined(MICRO_UI_USE_IMAGES) || defined(MICRO_UI_USE_FONTS)
+// ===== Panel streaming =====
+// Colour runs in raster order over a w x h box, written through one
+// address window clipped to the screen, or into the frame when there
+// is one. Off-screen parts of a run are dropped, so decoders can emit
+// whole rows without clipping themselves. Runs may carry on across rows.
+struct PanelStream {
+    int w = 0;
+    int left = 0, top = 0;
+    int col = 0, row = 0;
+    int firstRow = 0, lastRow = 0, firstCol = 0, endCol = 0;
+    uint32_t pixels = 0;
+
+    // False, with nothing opened, when the box is entirely off screen.
+    bool begin(int x, int y, int width, int height) {
+        int x0 = max(x, 0);
+        int y0 = max(y, 0);
+        int x1 = min(x + width, (int)ui->width);
+        int y1 = min(y + height, (int)ui->height);
+        if (panelClipped) {
+            // Raw windows ignore the viewport, so keep to the strip here
+            x0 = max(x0, (int)panelClip.x);
+            y0 = max(y0, (int)panelClip.y);
+            x1 = min(x1, panelClip.x + panelClip.w);
+            y1 = min(y1, panelClip.y + panelClip.h);
+        }
+        if (x0 >= x1 || y0 >= y1) return false;
+
+        w = width;
+        firstRow = y0 - y;
+        lastRow = y1 - y;
+        firstCol = x0 - x;
+        endCol = x1 - x;
+        pixels = (uint32_t)(x1 - x0) * (y1 - y0);
+#ifdef MICRO_UI_FRAMEBUFFER
+        if (onFrame()) {
+            left = x;
+            top = y;
+            frameMark(*ui, x0, y0, x1 - x0, y1 - y0);
+            return true;
+        }
+#endif
+        ui->panel->startWrite();
+        ui->panel->setAddrWindow(x0, y0, x1 - x0, y1 - y0);
+        return true;
     }
-    sldr.inUse = false;
-}
 
-void removeAllSliders() {
-    for (int i = 0; i < MAX_SLIDERS; i++) {
-        if (sliderList[i].inUse) {
-            if (sliderList[i].sprite) {
-                delete sliderList[i].sprite;
-                sliderList[i].sprite = nullptr;
+    bool done() const { return row >= lastRow; }
+
+    void push(uint16_t color, uint32_t n) {
+        while (n && row < lastRow) {
+            int run = (int)min(n, (uint32_t)(w - col));
+            if (row >= firstRow) {
+                int from = max(col, firstCol);
+                int to = min(col + run, endCol);
+                if (to > from) send(color, from, to);
+            }
+            n -= run;
+            col += run;
+            if (col == w) {
+                col = 0;
+                row++;
             }
-            sliderList[i].inUse = false;
         }
     }
-}
-
-void updateSliderValueFromTouch(SliderSprite &sldr, int tx) {
-    int range = sldr.w - SLIDER_BUTTON_SIZE;
-    int newValue = ((tx - sldr.x - SLIDER_BUTTON_SIZE / 2) * 100) / range;
-    newValue = constrain(newValue, 0, 100);
 
-    if (newValue != sldr.value) {
-        sldr.value = newValue;
-        drawSlider(sldr);
+    void send(uint16_t color, int from, int to) {
+#ifdef MICRO_UI_FRAMEBUFFER
+        if (onFrame()) {
+            frame().TFT_eSprite::drawFastHLine(left + from, top + row, to - from, color);  // Marked in begin()
+            return;
+        }
+#endif
+        ui->panel->pushColor(color, to - from);
     }
-}
 
-void handleTouchSliders(int tx, int ty) {
-    if (currentSliderIndex != -1) {
-        SliderSprite &sldr = sliderList[currentSliderIndex];
-        updateSliderValueFromTouch(sldr, tx);
-        return;
+    // Returns pixels sent.
+    uint32_t end() {
+#ifdef MICRO_UI_FRAMEBUFFER
+        if (onFrame()) return pixels;
+#endif
+        ui->panel->endWrite();
+        return pixels;
     }
+};
+#endif
 
-    for (int i = 0; i < MAX_SLIDERS; i++) {
-        SliderSprite &sldr = sliderList[i];
-        if (!sldr.inUse || !sldr.visible) continue;
+#ifdef MICRO_UI_USE_IMAGES
+// ===== Image Handling =====
+// Walks the run stream of a MicroImage. Repeats come back as one run;
+// literal pixels one at a time, so nothing is buffered. Truncated data
+// pads the rest of the image with BACKGROUND_COLOR.
+struct ImageReader {
+    const MicroImage &image;
+    const uint8_t *p;
+    const uint8_t *end;
+    uint8_t literal = 0;    // Literal pixels left in the current run
+
+    explicit ImageReader(const MicroImage &img) : image(img), p(img.data), end(img.data + img.dataSize) {}
+
+    uint16_t pixel() {
+        if (image.format == IMAGE_RLE_INDEXED) {
+            if (p >= end) return BACKGROUND_COLOR;
+            uint8_t index = *p++;
+            return index < image.paletteSize ? image.palette[index] : BACKGROUND_COLOR;
+        }
+        if (end - p < 2) { p = end; return BACKGROUND_COLOR; }
+        uint16_t color = p[0] | (p[1] << 8);
+        p += 2;
+        return color;
+    }
 
-        if (tx >= sldr.x && tx <= (sldr.x + sldr.w) &&
-            ty >= sldr.y && ty <= (sldr.y + sldr.h)) {
-            currentSliderIndex = i;
-            touchStartTime = millis();
-            sldr.pressed = true;
-            updateSliderValueFromTouch(sldr, tx);
-            break;
+    uint32_t next(uint16_t &color) {
+        if (literal) {
+            literal--;
+            color = pixel();
+            return 1;
         }
+        if (p >= end) {
+            color = BACKGROUND_COLOR;
+            return UINT32_MAX;
+        }
+        uint8_t control = *p++;
+        color = pixel();
+        if (control & 0x80) return (control & 0x7F) + 1;
+        literal = control;
+        return 1;
+    }
+};
+
+// Streams an image into one address window. Returns pixels sent.
+static uint32_t streamImage(int x, int y, const MicroImage &image) {
+    PanelStream out;
+    if (!out.begin(x, y, image.width, image.height)) return 0;
+
+    ImageReader in(image);
+    uint16_t color;
+    while (!out.done()) {
+        uint32_t run = in.next(color);
+        out.push(color, run);
     }
+    return out.end();
+}
+
+void drawImage(int x, int y, const MicroImage *image) {
+    if (!image || !image->width || !image->height) return;
+    UI_PROFILE_SCOPE(PROFILE_IMAGE);
+    uint32_t pixels = streamImage(x, y, *image);
+    UI_PROFILE_PIXELS(pixels);
+    (void)pixels;
 }
 
-void releaseActiveSlider() {
-    if (currentSliderIndex == -1) return;
 
-    int i = currentSliderIndex;
-    currentSliderIndex = -1;
+struct ImageWidget : Widget<ImageWidget, ImageView, MAX_IMAGES> {
+    static const UIWidgetKind kind = WIDGET_IMAGE;
+    static Store& store() { return ui->images; }
+
+    static void draw(int i) {
+        const UIRect &r = ui->images.rect[i];
+        drawImage(r.x, r.y, ui->images.list[i]->image);
+    }
+};
 
-    SliderSprite &sldr = sliderList[i];
-    sldr.pressed = false;
-    drawSlider(sldr);
+ImageHandle addImage(int x, int y, const MicroImage *image) {
+    if (!image) return ImageHandle();
+    int i = ImageWidget::add(sizeof(ImageView), x, y, image->width, image->height);
+    if (i < 0) return ImageHandle();    // Error: arena or live list full
+
+    ui->images.list[i]->image = image;
+    return ImageWidget::handleAt(i);
+}
 
-    if (millis() - touchStartTime >= BUTTON_DEBOUNCE_MS) {
-        if (sldr.callback) {
-            sldr.callback(sldr.value);
+// A smaller replacement leaves the old image's margin cleared to the
+// background; the widget then takes the new image's size.
+void setImage(ImageHandle handle, const MicroImage *image) {
+    int i = ImageWidget::find(handle);
+    if (i < 0 || !image || ui->images.list[i]->image == image) return;
+
+    UIRect &r = ui->images.rect[i];
+    if (image->width < r.w || image->height < r.h) {
+        UI_PROFILE_SCOPE(PROFILE_IMAGE);
+        if (image->width < r.w) {
+            ui->canvas->fillRect(r.x + image->width, r.y, r.w - image->width, r.h, BACKGROUND_COLOR);
+        }
+        if (image->height < r.h) {
+            ui->canvas->fillRect(r.x, r.y + image->height, min((int)r.w, (int)image->width), r.h - image->height, BACKGROUND_COLOR);
         }
     }
+    ui->images.list[i]->image = image;
+    r.w = image->width;
+    r.h = image->height;
+    ImageWidget::draw(i);
 }
-#endif
 
+void drawImage(ImageHandle handle) {
+    int i = ImageWidget::find(handle);
+    if (i >= 0) ImageWidget::draw(i);
+}
 
-void clearScreen() {
-    tft.fillScreen(BACKGROUND_COLOR);
+void drawAllImages() {
+    ImageWidget::drawAll();
+}
+
+void removeImage(ImageHandle handle) {
+    int i = ImageWidget::find(handle);
+    if (i >= 0) ImageWidget::remove(i);
+}
+
+void removeAllImages() {
+    ImageWidget::removeAll();
+}
+#endif
+
+// Enabled widget types, in draw and hit-test order.
+typedef WidgetRegistry<
 #ifdef MICRO_UI_USE_BUTTONS
-    removeAllButtons();
+    ButtonWidget,
 #endif
 #ifdef MICRO_UI_USE_SLIDERS
-    removeAllSliders();
+    SliderWidget,
+#endif
+#ifdef MICRO_UI_USE_LISTS
+    ListWidget,
+#endif
+#ifdef MICRO_UI_USE_CHARTS
+    ChartWidget,
+#endif
+#ifdef MICRO_UI_USE_PROGRESS
+    ProgressWidget,
+#endif
+#ifdef MICRO_UI_USE_GAUGES
+    GaugeWidget,
+#endif
+#ifdef MICRO_UI_USE_IMAGES
+    ImageWidget,
 #endif
 #ifdef MICRO_UI_USE_LABELS
-    removeAllLabels();
+    LabelWidget,
 #endif
+    WidgetListEnd> Widgets;
+
+// The arena is only recycled once every live list is empty.
+static void arenaReleaseIfEmpty() {
+    if (!Widgets::empty()) return;
+    ui->arenaTop = 0;
+    Widgets::resetFreeLists();
 }
 
-void microUILoopHandler() {
-    int tx, ty;
-    if (getTouch(tx, ty)) {
-#ifdef MICRO_UI_USE_BUTTONS
-        handleTouchButtons(tx, ty);
+// Runs the events queued before this call. A callback may clear the
+// screen; events for widgets that are gone still reach the event
+// handler, but not a widget callback.
+static void dispatchEvents() {
+    for (int n = ui->eventCount; n > 0; n--) {
+        UIEvent event = ui->eventQueue[ui->eventHead];
+        ui->eventHead = (ui->eventHead + 1) % EVENT_QUEUE_SIZE;
+        ui->eventCount--;
+        Widgets::fire(event);
+        if (ui->eventHandler) ui->eventHandler(event, ui->eventContext);
+    }
+}
+
+static bool widgetCaptured() {
+    return ui->touchCapture.type >= 0;
+}
+
+void drawAllWidgets() {
+    Widgets::drawAll();
+}
+
+void clearScreen() {
+    UI_PROFILE_SCOPE(PROFILE_CLEAR);
+#ifdef MICRO_UI_USE_SETTINGS
+    settingsFlush();    // Leaving a screen commits its changes
 #endif
-#ifdef MICRO_UI_USE_SLIDERS
-        handleTouchSliders(tx, ty);
+    ui->canvas->fillScreen(BACKGROUND_COLOR);
+    UI_PROFILE_PIXELS(panelClipped ? panelClip.w * panelClip.h : ui->width * ui->height);
+    Widgets::removeAll();
+}
+
+// ===== Screen Transitions =====
+// The screen function runs once per strip with the panel clipped to
+// that strip, so what is already on the panel stays until it is drawn
+// over. With the frame it runs once, and each strip is copied from the
+// frame instead. Strips are sized from the time taken so far: a frame
+// that runs over budget makes the next strip wider rather than the
+// whole transition longer.
+TransitionStats transitionStats;
+
+#ifdef MICRO_UI_FRAMEBUFFER
+static void showStrip(void (*)(), int x, int y, int w, int h) {
+    frame().pushSprite(x, y, x, y, w, h);
+}
+#else
+static void showStrip(void (*build)(), int x, int y, int w, int h) {
+    panelClip.x = x;
+    panelClip.y = y;
+    panelClip.w = w;
+    panelClip.h = h;
+    panelClipped = true;
+    ui->panel->setViewport(x, y, w, h, false);
+    Widgets::removeAll();               // In case build() does not start with clearScreen()
+    build();
+    ui->panel->resetViewport();
+    panelClipped = false;
+}
 #endif
-    } else {
-#ifdef MICRO_UI_USE_BUTTONS
-        releaseActiveButton();
+
+void showScreen(void (*build)(), UITransition transition, uint16_t durationMs) {
+    uint32_t start = micros();
+    transitionStats = TransitionStats();
+#ifdef MICRO_UI_FRAMEBUFFER
+    if (!onFrame()) transition = TRANSITION_NONE;     // Labels and sliders move the panel's viewport
 #endif
-#ifdef MICRO_UI_USE_SLIDERS
-        releaseActiveSlider();
+
+    // Slides need the scroll registers to run along x
+    bool slide = transition == TRANSITION_SLIDE_LEFT || transition == TRANSITION_SLIDE_RIGHT;
+    if (slide && ui->rotation != 1) {
+        transition = transition == TRANSITION_SLIDE_LEFT ? TRANSITION_WIPE_LEFT : TRANSITION_WIPE_RIGHT;
+        slide = false;
+    }
+    bool vertical = transition == TRANSITION_WIPE_DOWN;
+    bool fromEnd = transition == TRANSITION_WIPE_LEFT || transition == TRANSITION_SLIDE_LEFT;
+    int length = vertical ? ui->height : ui->width;
+    uint32_t duration = (uint32_t)durationMs * 1000;
+
+    if (transition == TRANSITION_NONE || !duration) {
+        build();
+        microUIFlush();
+        transitionStats.frames = 1;
+        transitionStats.slowestFrameMicros = transitionStats.totalMicros = micros() - start;
+        return;
+    }
+
+#ifdef MICRO_UI_FRAMEBUFFER
+    build();
+#endif
+    if (slide) panelScrollArea(0, length, 0);
+    int done = 0;
+    while (done < length) {
+        uint32_t frameStart = micros();
+        int target = (int)min<uint64_t>(length, (uint64_t)length * (frameStart - start + TRANSITION_FRAME_US) / duration);
+        target = max(target, done + 1);
+
+        // Slides draw into the frame memory lines about to leave the
+        // panel, then move the scroll start so they come in at the far
+        // edge as the old screen moves out.
+        int from = fromEnd ? length - target : done;
+        if (slide) from = fromEnd ? done : length - target;
+        if (vertical) {
+            showStrip(build, 0, from, ui->width, target - done);
+        } else {
+            showStrip(build, from, 0, target - done, ui->height);
+        }
+        if (slide) panelScrollStart((fromEnd ? target : length - target) % length);
+        done = target;
+
+        uint32_t frame = micros() - frameStart;
+        transitionStats.frames++;
+        if (frame > TRANSITION_FRAME_US) transitionStats.framesOverBudget++;
+        if (frame > transitionStats.slowestFrameMicros) transitionStats.slowestFrameMicros = frame;
+        if (done < length && frame < TRANSITION_FRAME_US) delayMicroseconds(TRANSITION_FRAME_US - frame);
+    }
+#ifdef MICRO_UI_FRAMEBUFFER
+    frameClean(*ui);                    // Every strip is out
+#endif
+    transitionStats.totalMicros = micros() - start;
+}
+
+void microUILoopHandler() {
+#ifdef MICRO_UI_PROFILE
+    static uint32_t lastLoop = 0;
+    uint32_t now = profileCycles();
+    if (lastLoop) profileRecord(PROFILE_FRAME, now - lastLoop);
+    lastLoop = now;
+#endif
+    UI_PROFILE_SCOPE(PROFILE_LOOP);
+#ifdef MICRO_UI_LATENCY
+    latencyBegin();
 #endif
+    MicroDisplay *selected = ui;
+    for (int d = 0; d < displayCount; d++) {
+        ui = displays[d];
+        int tx, ty;
+        if (getTouch(tx, ty)) {
+            if (widgetCaptured()) {
+                ui->touchCapture.x = tx;
+                ui->touchCapture.y = ty;
+                Widgets::drag(ui->touchCapture.type, tx, ty);
+            } else {
+                Widgets::press(tx, ty, 0);
+            }
+        } else if (widgetCaptured()) {
+            int8_t type = ui->touchCapture.type;
+            ui->touchCapture.type = -1;
+            Widgets::lift(type);
+        }
+        dispatchEvents();
+        microUIFlush();
     }
+    ui = selected;
+#ifdef MICRO_UI_LATENCY
+    latencyEnd();
+#endif
+#ifdef MICRO_UI_USE_SETTINGS
+    serviceSettings();
+#endif
 }
 
 // ===== Touch Handling =====
+// Every touch controller shares the calibration values in micro_ui.h.
 bool getTouch(int &x, int &y) {
-    if (touchscreen.touched()) {
-        TS_Point p = touchscreen.getPoint();
+    UI_PROFILE_SCOPE(PROFILE_TOUCH);
+    if (ui->touch && ui->touch->touched()) {
+        TS_Point p = ui->touch->getPoint();
 #ifdef DEBUG_TOUCH
         Serial.print("Raw Touch: X=");
         Serial.print(p.x);
@@ -523,12 +2759,12 @@ bool getTouch(int &x, int &y) {
         Serial.println(p.z);
 #endif
         // Map raw touch readings to screen pixel values.
-        x = map(p.x, MIN_TOUCH_X, MAX_TOUCH_X, 0, SCREEN_WIDTH);
-        y = map(p.y, MIN_TOUCH_Y, MAX_TOUCH_Y, 0, SCREEN_HEIGHT);
+        x = map(p.x, MIN_TOUCH_X, MAX_TOUCH_X, 0, ui->width);
+        y = map(p.y, MIN_TOUCH_Y, MAX_TOUCH_Y, 0, ui->height);
 
         // Ensure the mapped coordinates are within screen bounds.
-        x = constrain(x, 0, SCREEN_WIDTH);
-        y = constrain(y, 0, SCREEN_HEIGHT);
+        x = constrain(x, 0, ui->width);
+        y = constrain(y, 0, ui->height);
 #ifdef DEBUG_TOUCH
         Serial.print("Mapped Touch: X=");
         Serial.print(x);
@@ -540,7 +2776,7 @@ bool getTouch(int &x, int &y) {
     return false;
 }
 
-void drawProgressBar(int x, int y, int w, int h, int value, uint16_t fillColor = TFT_GREEN, uint16_t bgColor = TFT_DARKGREY) {
+void drawProgressBar(int x, int y, int w, int h, int value, uint16_t fillColor, uint16_t bgColor) {
     // Clamp to [0, 100]
     if (value < 0) value = 0;
     if (value > 100) value = 100;
@@ -549,7 +2785,7 @@ void drawProgressBar(int x, int y, int w, int h, int value, uint16_t fillColor =
     uint16_t borderColor = TFT_WHITE;
 
     // Outer border (1px)
-    tft.drawRect(x, y, w, h, borderColor);
+    ui->canvas->drawRect(x, y, w, h, borderColor);
 
     // Inner area dimensions (excluding border)
     int innerX = x + 1;
@@ -558,20 +2794,20 @@ void drawProgressBar(int x, int y, int w, int h, int value, uint16_t fillColor =
     int innerH = h - 2;
 
     // Clear background inside bar
-    tft.fillRect(innerX, innerY, innerW, innerH, bgColor);
+    ui->canvas->fillRect(innerX, innerY, innerW, innerH, bgColor);
 
     // Filled width
     int fillW = (innerW * value) / 100;
 
     // Draw filled portion
     if (fillW > 0) {
-        tft.fillRect(innerX, innerY, fillW, innerH, fillColor);
+        ui->canvas->fillRect(innerX, innerY, fillW, innerH, fillColor);
     }
 }
 
 void FullWidthProgressBar(int value) {
-    drawProgressBar(10, SCREEN_HEIGHT / 2 - 15, SCREEN_WIDTH-20, 30, value);
-};
+    drawProgressBar(10, ui->height / 2 - 15, ui->width - 20, 30, value);
+}
 
 inline void safeCopy(char* dest, const char* src, size_t maxLen) {
     if (!dest || !src || maxLen == 0) 
@@ -589,15 +2825,15 @@ inline void safeCopy(char* dest, char* src, size_t maxLen) {
 
 void microUIInit() {
     tft.begin();
-    tft.setRotation(1);  // Match your display orientation
-    tft.fillScreen(BACKGROUND_COLOR);
-
     touchscreenSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
     touchscreen.begin(touchscreenSPI);
-    touchscreen.setRotation(SCREEN_ROTATION);  // Match your screen orientation
+    displayBegin(primaryDisplay);       // SCREEN_ROTATION for both; match your screen orientation
+    ui = &primaryDisplay;
 }
 
 void drawTriangleWithBorder(int x, int y, int w, int h, int borderWidth, uint16_t fillColor, int16_t borderColor) {
+    UI_PROFILE_SCOPE(PROFILE_TRIANGLE);
+    UI_PROFILE_PIXELS((w + 1) * (h + 1) / 2 + 3 * borderWidth * (w + h));
     int cx = x + w / 2;
     int top = y;
     int left = x;
@@ -605,21 +2841,22 @@ void drawTriangleWithBorder(int x, int y, int w, int h, int borderWidth, uint16_
     int bottom = y + h;
 
     // always fill (defaults to TFT_BLACK)
-    tft.fillTriangle(cx, top, left, bottom, right, bottom, fillColor);
+    ui->canvas->fillTriangle(cx, top, left, bottom, right, bottom, fillColor);
 
     // Draw border if requested
     if (borderWidth > 0) {
         for (int i = 0; i < borderWidth; i++) {
             // Offset inward to create border thickness
-            tft.drawLine(cx, top + i, left + i, bottom - i, borderColor);
-            tft.drawLine(left + i, bottom - i, right - i, bottom - i, borderColor);
-            tft.drawLine(right - i, bottom - i, cx, top + i, borderColor);
+            ui->canvas->drawLine(cx, top + i, left + i, bottom - i, borderColor);
+            ui->canvas->drawLine(left + i, bottom - i, right - i, bottom - i, borderColor);
+            ui->canvas->drawLine(right - i, bottom - i, cx, top + i, borderColor);
         }
     }
 }
 
 void drawCircleWithBorder(int x, int y, int radius, int borderWidth, uint16_t fillColor, uint16_t borderColor) {
-    TFT_eSprite spr = TFT_eSprite(&tft);
+    UI_PROFILE_SCOPE(PROFILE_CIRCLE);
+    TFT_eSprite spr = TFT_eSprite(ui->panel);
     int size = radius * 2 + 1;
     spr.createSprite(size, size);
     spr.fillSprite(TFT_TRANSPARENT); // Or a background color if needed
@@ -645,13 +2882,15 @@ void drawCircleWithBorder(int x, int y, int radius, int borderWidth, uint16_t fi
       }
     }
   
-    spr.pushSprite(x, y);
+    pushSpriteRect(spr, x, y, 0, 0, size, size);
+    UI_PROFILE_PIXELS(size * size);
     spr.deleteSprite();
 }
 
 void drawQuarterCircleWithBorder(int x, int y, int radius, int borderWidth, uint16_t fillColor, uint16_t borderColor, Quarter quarter) {
+    UI_PROFILE_SCOPE(PROFILE_QUARTER);
     // The sprite will be sized so that indices run from 0 to radius.
-    TFT_eSprite spr = TFT_eSprite(&tft);
+    TFT_eSprite spr = TFT_eSprite(ui->panel);
     int size = radius + 1;
     spr.createSprite(size, size);
     spr.fillSprite(TFT_TRANSPARENT);  // Or use a background color if needed
@@ -753,24 +2992,298 @@ void drawQuarterCircleWithBorder(int x, int y, int radius, int borderWidth, uint
     }
   
     // Push the sprite to the display at (x,y) and clean up.
-    spr.pushSprite(x, y);
+    pushSpriteRect(spr, x, y, 0, 0, size, size);
+    UI_PROFILE_PIXELS(size * size);
     spr.deleteSprite();
 }
   
+// ===== Arc spans =====
+// A ring sector is rasterised row by row. The ring gives at most two x
+// ranges per row and each sector edge is a half-plane, which is also a
+// range along the row, so every row is one or two fillRect() spans and
+// no pixel is tested or sent twice. Sectors wider than 90° are split.
+// The start edge is inclusive and the end edge exclusive, so adjacent
+// sectors tile exactly and a delta update matches a full redraw.
+#define ARC_RAD_PER_DEG     0.017453292519943295f
+
+struct ArcEdge { float a, b; bool strict; };   // Holds where a*dx + b*dy >= 0 (> 0 if strict)
+
+static bool arcEdgeHolds(const ArcEdge &e, int dx, float rowTerm) {
+    float v = e.a * dx + rowTerm;
+    return e.strict ? v > 0 : v >= 0;
+}
+
+// Narrows [lo, hi] to where the edge holds. The test is linear in dx, so
+// what is left is still a range; its end is found by bisection on the
+// same test, which keeps spans exact however the edge is angled.
+static void arcClip(const ArcEdge &e, int dy, int &lo, int &hi) {
+    if (lo > hi) return;
+    float rowTerm = e.b * dy;
+    bool atLo = arcEdgeHolds(e, lo, rowTerm);
+    bool atHi = arcEdgeHolds(e, hi, rowTerm);
+    if (atLo && atHi) return;
+    if (!atLo && !atHi) {
+        lo = hi + 1;
+        return;
+    }
+    int pass = atLo ? lo : hi;
+    int fail = atLo ? hi : lo;
+    while (abs(fail - pass) > 1) {
+        int mid = pass + (fail - pass) / 2;
+        if (arcEdgeHolds(e, mid, rowTerm)) pass = mid; else fail = mid;
+    }
+    if (atLo) hi = pass; else lo = pass;
+}
+
+static int isqrt(int n) {
+    int s = (int)sqrtf((float)n);
+    while (s * s > n) s--;
+    while ((s + 1) * (s + 1) <= n) s++;
+    return s;
+}
+
+// One sector of at most 90°; returns the pixels sent.
+static uint32_t fillArcPiece(int cx, int cy, int outerR, int innerR, float a0, float a1, uint16_t color) {
+    float r0 = a0 * ARC_RAD_PER_DEG;
+    float r1 = a1 * ARC_RAD_PER_DEG;
+    float rm = (r0 + r1) / 2;
+    const ArcEdge edges[3] = {
+        {  cosf(r0),  sinf(r0), false },   // Clockwise of the start ray
+        { -cosf(r1), -sinf(r1), true  },   // Anticlockwise of the end ray
+        {  sinf(rm), -cosf(rm), true  },   // Same side as the bisector
+    };
+
+    uint32_t pixels = 0;
+    for (int dy = -outerR; dy <= outerR; dy++) {
+        int xo = isqrt(outerR * outerR - dy * dy);
+        int xi = (innerR >= 0 && dy * dy <= innerR * innerR) ? isqrt(innerR * innerR - dy * dy) : -1;
+        int ranges[2][2] = { { -xo, xo } };
+        int count = 1;
+        if (xi >= 0) {                      // Row crosses the hole
+            ranges[0][1] = -xi - 1;
+            ranges[1][0] = xi + 1;
+            ranges[1][1] = xo;
+            count = 2;
+        }
+        for (int k = 0; k < count; k++) {
+            int lo = ranges[k][0];
+            int hi = ranges[k][1];
+            for (const ArcEdge &e : edges) arcClip(e, dy, lo, hi);
+            if (lo > hi) continue;
+            ui->canvas->fillRect(cx + lo, cy + dy, hi - lo + 1, 1, color);
+            pixels += hi - lo + 1;
+        }
+    }
+    return pixels;
+}
+
+static uint32_t fillArcSpans(int cx, int cy, int radius, int thickness, float startAngle, float endAngle, uint16_t color) {
+    uint32_t pixels = 0;
+    int innerR = radius - thickness;
+    for (float a0 = startAngle; a0 < endAngle; a0 += 90) {
+        pixels += fillArcPiece(cx, cy, radius, innerR, a0, min(a0 + 90, endAngle), color);
+    }
+    return pixels;
+}
+
+// Pixels with innerR < distance <= radius, where innerR = radius - thickness,
+// clockwise from startAngle (inclusive) to endAngle (exclusive) in
+// degrees, 0 at 12 o'clock. thickness > radius fills a pie slice.
+void fillArc(int cx, int cy, int radius, int thickness, float startAngle, float endAngle, uint16_t color) {
+    UI_PROFILE_SCOPE(PROFILE_GAUGE);
+    uint32_t pixels = fillArcSpans(cx, cy, radius, thickness, startAngle, endAngle, color);
+    UI_PROFILE_PIXELS(pixels);
+    (void)pixels;
+}
+
 void drawText(int x, int y, const char* txt, uint8_t fontCode, uint16_t textColor) {
-    tft.setTextColor(textColor);
-    tft.setTextFont(fontCode);
-    tft.setCursor(x, y);
-    tft.print(txt);
+    UI_PROFILE_SCOPE(PROFILE_TEXT);
+    ui->canvas->setTextColor(textColor);
+    ui->canvas->setTextFont(fontCode);
+    ui->canvas->setCursor(x, y);
+    ui->canvas->print(txt);
 }
   
 void drawCenteredText(const char *message, uint8_t fontCode, uint16_t textColor, uint16_t bgColor) {
-    tft.setTextColor(textColor, bgColor);
-    tft.setTextFont(fontCode);
-    tft.setTextDatum(MC_DATUM);          // centers the text both horizontally and vertically
-    tft.drawString(message, SCREEN_WIDTH/2, SCREEN_HEIGHT/2);
+    UI_PROFILE_SCOPE(PROFILE_TEXT);
+    ui->canvas->setTextColor(textColor, bgColor);
+    ui->canvas->setTextFont(fontCode);
+    ui->canvas->setTextDatum(MC_DATUM);          // centers the text both horizontally and vertically
+    ui->canvas->drawString(message, ui->width / 2, ui->height / 2);
+}
+
+#ifdef MICRO_UI_USE_FONTS
+// ===== Font text =====
+// Text is streamed row by row through one address window covering the
+// line box. Each row walks the string again rather than buffering it,
+// and neighbouring glyphs that overlap (kerning, overhangs) take the
+// stronger coverage. Equal colours merge into one pushColor() run, so
+// background and solid strokes cost a single call however long.
+// Fonts cover the Basic Multilingual Plane; anything above maps to
+// U+FFFD, which a subset normally lacks, so it is skipped.
+static uint16_t utf8Next(const char *&s) {
+    uint8_t c = *s++;
+    if (c < 0x80) return c;
+    int extra = c >= 0xF0 ? 3 : (c >= 0xE0 ? 2 : (c >= 0xC0 ? 1 : 0));
+    uint32_t code = c & (0x3F >> extra);
+    while (extra-- && (*s & 0xC0) == 0x80) code = (code << 6) | (*s++ & 0x3F);
+    return code > 0xFFFF ? 0xFFFD : code;
+}
+
+static const MicroFontGlyph* fontGlyph(const MicroFont &font, uint16_t code) {
+    int lo = 0, hi = font.glyphCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        uint16_t c = font.glyphs[mid].codepoint;
+        if (c == code) return &font.glyphs[mid];
+        if (c < code) lo = mid + 1; else hi = mid - 1;
+    }
+    return nullptr;
+}
+
+static int fontKerning(const MicroFont &font, uint16_t left, uint16_t right) {
+    uint32_t key = ((uint32_t)left << 16) | right;
+    int lo = 0, hi = font.kernCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        uint32_t k = ((uint32_t)font.kerns[mid].left << 16) | font.kerns[mid].right;
+        if (k == key) return font.kerns[mid].adjust;
+        if (k < key) lo = mid + 1; else hi = mid - 1;
+    }
+    return 0;
+}
+
+// Glyphs of a string with their pen positions, kerning applied.
+struct GlyphWalker {
+    const MicroFont *font;
+    const char *p;
+    const MicroFontGlyph *glyph = nullptr;
+    int pen = 0;        // Pen position of `glyph`
+    int advance = 0;    // Pen position after it
+
+    GlyphWalker(const MicroFont &f, const char *text) : font(&f), p(text) {}
+
+    bool next() {
+        while (*p) {
+            uint16_t code = utf8Next(p);
+            const MicroFontGlyph *g = fontGlyph(*font, code);
+            if (!g) continue;
+            if (glyph) advance += fontKerning(*font, glyph->codepoint, code);
+            glyph = g;
+            pen = advance;
+            advance += g->xAdvance;
+            return true;
+        }
+        return false;
+    }
+
+    // Ink columns of the current glyph on `row`, or false if it has none.
+    bool span(int row, int &x0, int &x1) const {
+        if (row < glyph->yOffset || row >= glyph->yOffset + glyph->height) return false;
+        x0 = pen + glyph->xOffset;
+        x1 = x0 + glyph->width;
+        return true;
+    }
+
+    // Bit index of pixel (x, row); levels follow every bpp bits.
+    uint32_t bitAt(int x, int row) const {
+        const MicroFontGlyph &g = *glyph;
+        return ((uint32_t)(row - g.yOffset) * g.width + (x - pen - g.xOffset)) * font->bpp;
+    }
+
+    uint8_t levelAt(uint32_t bit) const {
+        uint8_t byte = font->bitmaps[glyph->bitmap + (bit >> 3)];
+        return (byte >> (8 - font->bpp - (bit & 7))) & ((1 << font->bpp) - 1);
+    }
+};
+
+// Merges equal neighbouring colours before they reach the panel.
+struct RunMerger {
+    PanelStream &out;
+    uint16_t color = 0;
+    uint32_t count = 0;
+
+    explicit RunMerger(PanelStream &stream) : out(stream) {}
+
+    void add(uint16_t c, uint32_t n) {
+        if (!n) return;
+        if (count && c != color) flush();
+        color = c;
+        count += n;
+    }
+
+    void flush() {
+        if (count) out.push(color, count);
+        count = 0;
+    }
+};
+
+static uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    uint32_t r = ((fg >> 11) * alpha + (bg >> 11) * (255 - alpha) + 127) / 255;
+    uint32_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (255 - alpha) + 127) / 255;
+    uint32_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * (255 - alpha) + 127) / 255;
+    return (r << 11) | (g << 5) | b;
+}
+
+int fontTextWidth(const MicroFont *font, const char *text) {
+    if (!font || !text) return 0;
+    GlyphWalker walk(*font, text);
+    while (walk.next()) {}
+    return walk.advance;
 }
 
+void drawFontText(int x, int y, const char *text, const MicroFont *font, uint16_t textColor, uint16_t bgColor) {
+    if (!font || !text || !font->glyphCount) return;
+    UI_PROFILE_SCOPE(PROFILE_TEXT);
+
+    // Line box: the advance, widened by any ink hanging outside it
+    int left = 0, right = 0;
+    GlyphWalker measure(*font, text);
+    while (measure.next()) {
+        left = min(left, measure.pen + measure.glyph->xOffset);
+        right = max(right, measure.pen + measure.glyph->xOffset + (int)measure.glyph->width);
+    }
+    right = max(right, measure.advance);
+
+    PanelStream out;
+    if (!out.begin(x + left, y, right - left, font->lineHeight)) return;
+
+    uint16_t ramp[16];
+    int levels = (1 << font->bpp) - 1;
+    for (int i = 0; i <= levels; i++) ramp[i] = blend565(textColor, bgColor, i * 255 / levels);
+
+    RunMerger runs(out);
+    for (int row = 0; row < font->lineHeight && !out.done(); row++) {
+        int cx = left;
+        GlyphWalker cur(*font, text);
+        bool more = cur.next();
+        while (more) {
+            GlyphWalker next = cur;
+            bool hasNext = next.next();
+            int x0, x1, n0 = 0, n1 = 0;
+            bool nextInk = hasNext && next.span(row, n0, n1);
+            if (cur.span(row, x0, x1) && x1 > cx) {
+                if (x0 > cx) runs.add(bgColor, x0 - cx);
+                int px = max(cx, x0);
+                for (uint32_t bit = cur.bitAt(px, row); px < x1; px++, bit += font->bpp) {
+                    uint8_t level = cur.levelAt(bit);
+                    if (nextInk && px >= n0 && px < n1) level = max(level, next.levelAt(next.bitAt(px, row)));
+                    runs.add(ramp[level], 1);
+                }
+                cx = x1;
+            }
+            cur = next;
+            more = hasNext;
+        }
+        runs.add(bgColor, right - cx);
+    }
+    runs.flush();
+    uint32_t pixels = out.end();
+    UI_PROFILE_PIXELS(pixels);
+    (void)pixels;
+}
+#endif
+
 void drawTriangleWithBorder(int x, int y, int w, int h, uint16_t fillColor, int16_t borderColor = -1, uint8_t borderWidth = 1) {
     int cx = x + w / 2;
     int top = y;
@@ -780,16 +3293,16 @@ void drawTriangleWithBorder(int x, int y, int w, int h, uint16_t fillColor, int1
 
     // Fill triangle if fillColor is set
     if (fillColor != -1) {
-        tft.fillTriangle(cx, top, left, bottom, right, bottom, fillColor);
+        ui->canvas->fillTriangle(cx, top, left, bottom, right, bottom, fillColor);
     }
 
     // Draw border if requested
     if (borderColor != -1 && borderWidth > 0) {
         for (uint8_t i = 0; i < borderWidth; i++) {
             // Offset inward to create border thickness
-            tft.drawLine(cx, top + i, left + i, bottom - i, borderColor);
-            tft.drawLine(left + i, bottom - i, right - i, bottom - i, borderColor);
-            tft.drawLine(right - i, bottom - i, cx, top + i, borderColor);
+            ui->canvas->drawLine(cx, top + i, left + i, bottom - i, borderColor);
+            ui->canvas->drawLine(left + i, bottom - i, right - i, bottom - i, borderColor);
+            ui->canvas->drawLine(right - i, bottom - i, cx, top + i, borderColor);
         }
     }
 }
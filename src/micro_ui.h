@@ -10,7 +10,17 @@
 - Each UI element includes an identifier for efficient updates and tracking.
 - Sliders with draggable and full-track touch support, with callbacks.
 - Labels rendered via off-screen sprites for flicker-free updates.
+- Virtualised scrolling lists and tables using the panel's hardware scroll.
+- Sweeping strip charts with min/max decimation and several series.
 - Touch handler with state tracking and debounce logic.
+- Per-screen arena widget storage, released in one step by clearScreen().
+- Widget types share one registry with static dispatch; unused types compile out.
+- Settings with dirty tracking and deferred background commits.
+- Optional frame-time and per-widget draw profiler.
+- Retained progress bars and arc gauges that repaint only what changed.
+- Run-length compressed images in flash, decoded straight to the panel.
+- Subset anti-aliased fonts with kerning, drawn as colour spans in one window.
+- Several displays, each with its own widget tree, sharing font caches.
 - Progress bars, common shapes, and direct text drawing support.
 - Designed for use with ESP32 and similar microcontrollers.
 */
@@ -28,6 +38,13 @@ extern TFT_eSPI tft;
 #define MICRO_UI_USE_BUTTONS
 #define MICRO_UI_USE_LABELS
 #define MICRO_UI_USE_SLIDERS
+#define MICRO_UI_USE_LISTS
+#define MICRO_UI_USE_CHARTS
+#define MICRO_UI_USE_PROGRESS
+#define MICRO_UI_USE_GAUGES
+#define MICRO_UI_USE_IMAGES
+#define MICRO_UI_USE_FONTS
+#define MICRO_UI_USE_SETTINGS
 
 // ===== Touchscreen Setup =====
 #define XPT2046_IRQ  36
@@ -40,6 +57,7 @@ extern SPIClass touchscreenSPI;
 extern XPT2046_Touchscreen touchscreen;
 
 // ===== Screen Setup =====
+// The primary display; others are sized when declared (see "Displays").
 #define SCREEN_ROTATION     1 
 #define SCREEN_WIDTH        320
 #define SCREEN_HEIGHT       240
@@ -47,6 +65,24 @@ extern XPT2046_Touchscreen touchscreen;
 // Debug touch calibration values
 // #define DEBUG_TOUCH
 
+// Frame-time and per-widget draw profiler. Compiled out entirely
+// unless defined; see "Profiler" below.
+// #define MICRO_UI_PROFILE
+
+// Touch-to-photon latency histogram and on-screen marker. Compiled out
+// unless defined; see "Latency" below.
+// #define MICRO_UI_LATENCY
+
+// Off-screen framebuffer for boards with PSRAM (WROVER and similar).
+// Everything draws into one SCREEN_WIDTH x SCREEN_HEIGHT RGB565 sprite,
+// 150 KB, and only the lines that changed go to the panel at the end
+// of each microUILoopHandler() pass. Labels and sliders then need no
+// sprites of their own, overlapping widgets composite in draw order,
+// and the frame can be read back (see "Framebuffer" below). Without
+// PSRAM, or if the frame cannot be allocated, drawing goes straight to
+// the panel as usual.
+// #define MICRO_UI_FRAMEBUFFER
+
 // Values used to map the raw touch coordinates to screen pixels.
 #define MIN_TOUCH_X         268
 #define MAX_TOUCH_X         3814
@@ -68,34 +104,66 @@ extern XPT2046_Touchscreen touchscreen;
 
 // UI memory usage estimates (ESP32 / 32-bit MCU assumed)
 //
-// Struct sizes (estimated):
-// SimpleButton:   ~64 bytes
-// LabelSprite:    ~68 bytes (not including sprite data)
-// SliderSprite:   ~60 bytes (not including sprite data)
+// Widgets for the current screen share one arena; each takes only
+// what it needs (estimated):
+// SimpleButton:   ~52 bytes, plus w*h/2 bytes of heap while it holds a
+//                 face sprite (see BUTTON_FACES)
+// LabelSprite:    ~56 bytes + TFT_eSprite object (not including sprite data)
+// SliderSprite:   ~44 bytes + TFT_eSprite object (not including sprite data)
+//                 Neither has a sprite with MICRO_UI_FRAMEBUFFER.
+// ScrollList:     ~60 bytes + TFT_eSprite object (one row of sprite data,
+//                 however many rows the list has)
+// TrendChart:     ~56 bytes + TFT_eSprite object + 2 bytes per column
+//                 and series of history (one column of sprite data)
+// ProgressBar:    ~16 bytes, ArcGauge: ~24 bytes (no sprites)
+// ImageView:      ~8 bytes; pixels stay in flash and are decoded
+//                 straight into the SPI stream, with no row buffer
+// plus 12 bytes of hot data per widget: an int16 rect, flag bits and
+// a live list entry.
 //
 // ================ Configurable Limits ==================
-// The following values define the maximum number of UI elements.
-// ESP32 has generous RAM, so defaults are safe for most apps.
-// However, if you wish to tighten memory usage, simply reduce
-// these values to match the number of buttons, labels, or sliders
-// you actually need in your UI.
+// MICRO_UI_ARENA_SIZE bounds the widgets on one screen. Size it to the
+// busiest screen; microUIArenaPeak() reports the high-water mark. Each
+// display has an arena of its own.
+// The MAX_* values only cap the live lists (4 bytes per entry).
 
-#define MAX_BUTTONS         20    // 20x = ~1280 bytes total (20 x 64)
+#define MICRO_UI_ARENA_SIZE 6144  // Widget storage for one screen, all types
+
+#define MAX_BUTTONS         20    // Live buttons per screen
 #define MAX_BUTTON_TEXT     10    // Each button has label[10]
-#define MAX_LABELS          20    // 20x = ~1360 bytes total (20 x 68)
+#define MAX_LABELS          20    // Live labels per screen
 #define MAX_LABEL_TEXT      32    // Each label has lastText[32]
-#define MAX_SLIDERS         10    // 10x = ~600 bytes total (10 x 60)
-
+#define MAX_SLIDERS         10    // Live sliders per screen
+#define MAX_LISTS           2     // Live lists per screen
+#define MAX_LIST_TEXT       32    // Longest cell text, including the terminator
+#define MAX_CHARTS          2     // Live charts per screen
+#define CHART_MAX_SERIES    3     // Traces per chart
+#define MAX_PROGRESS_BARS   4     // Live progress bars per screen
+#define MAX_GAUGES          4     // Live arc gauges per screen
+#define MAX_IMAGES          8     // Live images per screen
+
+#define EVENT_QUEUE_SIZE    8     // Events held until the end of a loop pass (20 bytes each)
 #define BUTTON_DEBOUNCE_MS  25    // Debounce time - ignore glitchy touches
+#define BUTTON_FACES        4     // Buttons that keep their face in a 4-bit sprite; 0 for none
+#define BUTTON_FACE_MAX_PIXELS  20000 // Larger buttons always draw straight to the panel
+#define TEXT_FONT_CACHE     3     // TFT_eSPI fonts whose glyph advances are kept (~100 bytes each)
 
 #define SLIDER_TRACK_THICKNESS  6
 #define SLIDER_BUTTON_SIZE      30
 
+#define LIST_DRAG_SLOP          6     // A touch moving further than this scrolls instead of selecting
+
+#define CHART_SWEEP_GAP         4     // Blank columns kept ahead of the newest sample
+#define CHART_GRID_LINES        4     // Horizontal divisions; 0 for none
+
+#define MAX_SETTINGS            16    // Dirty state is tracked in a 32-bit mask
+#define SETTINGS_QUIET_MS       1500  // Commit once settings stop changing for this long
+#define SETTINGS_TASK_STACK     4096
+#define SETTINGS_TASK_PRIORITY  1     // Below the Arduino loop task
+
 void safeCopy(char* dest, const char* src, size_t maxLen);
 void safeCopy(char* dest, char* src, size_t maxLen);
 
-extern unsigned long   touchStartTime;
-
 enum Quarter {
     TOP_LEFT,
     TOP_RIGHT,
@@ -103,30 +171,240 @@ enum Quarter {
     BOTTOM_RIGHT
 };
 
+#ifdef MICRO_UI_PROFILE
+    // Each micro_ui entry point is timed with the CPU cycle counter and
+    // binned into a log-scale histogram per widget type (4 bins per
+    // octave, so percentiles are within ~19%). Pixels written by that
+    // entry point are counted alongside. PROFILE_LOOP times the whole
+    // microUILoopHandler() call and PROFILE_FRAME the interval between
+    // calls, whose spread is the loop jitter.
+    // Dump it with 'p' through microUICommand() below, reset with 'r'.
+    enum ProfileKind {
+        PROFILE_TOUCH,
+        PROFILE_BUTTON,
+        PROFILE_LABEL,
+        PROFILE_SLIDER,
+        PROFILE_LIST,
+        PROFILE_CHART,
+        PROFILE_PROGRESS,
+        PROFILE_GAUGE,
+        PROFILE_IMAGE,
+        PROFILE_CIRCLE,
+        PROFILE_QUARTER,
+        PROFILE_TRIANGLE,
+        PROFILE_TEXT,
+        PROFILE_CLEAR,
+        PROFILE_LOOP,
+        PROFILE_FRAME,
+        PROFILE_KINDS
+    };
+
+    #define PROFILE_BINS        128
+
+    struct ProfileStats {
+        uint32_t count;
+        uint32_t maxCycles;
+        uint64_t totalCycles;
+        uint64_t pixels;
+        uint16_t bins[PROFILE_BINS];    // Saturating counts
+    };
+
+    struct ProfileScope {
+        explicit ProfileScope(ProfileKind kind);
+        ~ProfileScope();
+        ProfileKind kind;
+        int8_t      outer;
+        uint32_t    start;
+    };
+
+    extern ProfileStats profileStats[PROFILE_KINDS];
+
+    void     profileAddPixels(uint32_t pixels);
+    uint32_t profilePercentile(ProfileKind kind, uint8_t percent);
+    void     microUIProfileReset();
+    void     microUIProfileDump(Print &out);
+    void     drawProfileOverlay(int x, int y);
+
+    #define UI_PROFILE_SCOPE(kind)      ProfileScope uiProfileScope(kind)
+#else
+    #define UI_PROFILE_SCOPE(kind)
+#endif
+
+#ifdef MICRO_UI_LATENCY
+    // Each microUILoopHandler() pass stamps its touch sample with
+    // micros() before the controller is read. Pixels pushed while that
+    // sample is dispatched (press, drag, lift and any callback) are
+    // tagged with it, and once they are out the elapsed time is binned.
+    // Samples that draw nothing are not counted. With every recorded
+    // response a square in the top-right corner flips between black and
+    // white, so a high-speed camera can time finger to marker on its own.
+    // Dump it with 'l' through microUICommand() below, reset with 'r'.
+    #define LATENCY_BIN_US      1000    // Histogram bin width
+    #define LATENCY_BINS        32      // The last bin also takes anything slower
+    #define LATENCY_MARKER_SIZE 8       // 0 for no marker
+
+    struct LatencyStats {
+        uint32_t count;
+        uint32_t minMicros;
+        uint32_t maxMicros;
+        uint32_t lastMicros;
+        uint64_t totalMicros;
+        uint16_t bins[LATENCY_BINS];    // Saturating counts
+    };
+
+    extern LatencyStats latencyStats;
+
+    void     latencyAddPixels(uint32_t pixels);
+    uint32_t latencyPercentile(uint8_t percent);
+    void     microUILatencyReset();
+    void     microUILatencyDump(Print &out);
+#endif
+
+#if defined(MICRO_UI_PROFILE) || defined(MICRO_UI_LATENCY)
+    // micro_ui never reads Serial itself. Pass it each command byte the
+    // sketch reads: 'p' dumps the profiler, 'l' the latency histogram
+    // and 'r' resets both. Any other byte is ignored.
+    //   while (Serial.available()) microUICommand(Serial.read());
+    void     microUICommand(int c, Print &out = Serial);
+#endif
+
+// Pixels a draw pushed, for the profiler and the latency tags.
+#if defined(MICRO_UI_PROFILE) && defined(MICRO_UI_LATENCY)
+    #define UI_PROFILE_PIXELS(n)        do { uint32_t uiPixels = (n); profileAddPixels(uiPixels); latencyAddPixels(uiPixels); } while (0)
+#elif defined(MICRO_UI_PROFILE)
+    #define UI_PROFILE_PIXELS(n)        profileAddPixels(n)
+#elif defined(MICRO_UI_LATENCY)
+    #define UI_PROFILE_PIXELS(n)        latencyAddPixels(n)
+#else
+    #define UI_PROFILE_PIXELS(n)
+#endif
+
+// Widget storage is split hot/cold. Rects and flag bits live in
+// packed arrays indexed like the live list, so touch dispatch and
+// redraw walks stay within a few cache lines; the structs below hold
+// only what is needed once a widget is drawn or fires.
+struct UIRect { int16_t x, y, w, h; };
+
+// Where a button's or label's text sits, measured once and kept until
+// the text or font changes. Glyphs are drawn one by one from x, y, so
+// redraws neither measure the string nor work out the datum again.
+struct TextLayout {
+    int16_t x, y;                   // Top-left of the text, relative to the widget
+    int16_t width;
+    uint8_t height;
+    uint8_t font;                   // 0 until laid out
+};
+
+// Every widget type shares one handle and one store layout, so handle
+// validation and the draw and hit-test loops are written once (see the
+// registry in micro_ui.cpp). Handles are typed by widget, so a label
+// handle cannot be passed where a button is expected.
+template <typename Cold>
+struct WidgetHandle { int index = -1; uint32_t generation = 0; };
+
+template <typename Cold, int Max>
+struct WidgetStore {
+    Cold*       list[Max];          // Packed, in draw order
+    UIRect      rect[Max];
+    uint32_t    visible     = 0;    // Bit i: list[i]
+    uint32_t    pressed     = 0;
+    int         count       = 0;
+    void*       freeList    = nullptr;
+};
+
+// ===== Events =====
+// Touches on widgets are posted to a bounded queue while the loop
+// handles the sample and draws the feedback. The queue is dispatched at
+// the end of the same microUILoopHandler() pass, once that frame is out:
+// first to the widget's own callback, then to the event handler, if one
+// is set. A callback that switches screens therefore never runs inside
+// a widget's touch handling. Events posted during dispatch wait for the
+// next pass; when the queue is full, new events are dropped and counted.
+// Each display has its own queue and handler (see "Displays").
+enum UIEventType : uint8_t {
+    EVENT_PRESS,                    // Finger down on a widget
+    EVENT_RELEASE,                  // Finger up after EVENT_PRESS
+    EVENT_CLICK,                    // Button released after the debounce time
+    EVENT_VALUE,                    // Slider released; value is 0-100
+    EVENT_SELECT,                   // List row tapped; value is the row
+};
+
+enum UIWidgetKind : uint8_t {
+    WIDGET_BUTTON,
+    WIDGET_SLIDER,
+    WIDGET_LIST,
+    WIDGET_CHART,
+    WIDGET_PROGRESS,
+    WIDGET_GAUGE,
+    WIDGET_IMAGE,
+    WIDGET_LABEL,
+};
+
+struct UIEvent {
+    UIEventType     type;
+    UIWidgetKind    widget;
+    int16_t         value;
+    int16_t         id;             // As given to setCallback(), 0 if none
+    int16_t         x, y;           // Touch position
+    int             index;          // Handle of the widget, as in WidgetHandle
+    uint32_t        generation;
+};
+
+// True if the event came from the widget behind `handle`.
+template <typename Cold>
+inline bool eventFrom(const UIEvent &event, WidgetHandle<Cold> handle) {
+    return event.index == handle.index && event.generation == handle.generation;
+}
+
+// Widget callbacks that take the event rather than a label or value:
+// the handle and id in the event say which widget fired, so one
+// function can serve a whole keypad with a switch on event.id.
+typedef void (*UIEventCallback)(const UIEvent &event, void *context);
+
+void     setEventHandler(UIEventCallback handler, void *context = nullptr);
+uint32_t microUIEventsDropped();
+
+#ifdef MICRO_UI_USE_SETTINGS
+    // Settings are int fields owned by the application. Changes made
+    // through setSetting() are tracked per field and handed to the
+    // commit callback on a background task once the user has been idle
+    // for SETTINGS_QUIET_MS, or when the screen is cleared. The loop
+    // never waits on the filesystem.
+    struct SettingHandle   { int index = -1; };
+
+    SettingHandle addSetting(int* field);
+    void setSetting(SettingHandle handle, int value);
+    int  getSetting(SettingHandle handle);
+    void settingsSetCommitCallback(bool (*commit)(uint32_t dirtyMask));
+    void settingsSnapshot(void* dest, const void* src, size_t len);
+    void settingsFlush();
+    bool settingsPending();
+#endif
+
 #ifdef MICRO_UI_USE_BUTTONS
     struct SimpleButton {
-        int x, y, w, h;
         char label[MAX_BUTTON_TEXT];
-        void (*callback)(const char *label);
-        bool visible;
         uint8_t fontCode;
         uint16_t bgNormal;
         uint16_t bgPressed;
-        uint16_t textColor;
-        bool pressed;
+        void (*callback)(const char *label);
+        UIEventCallback onEvent;        // Gets EVENT_CLICK; see setCallback()
+        void *context;
+        int16_t id;
+        TextLayout layout;
+        uint8_t face;                   // 1 + face pool slot, 0 if drawn direct
         uint32_t generation = 0;
-        bool inUse = false;
     };
 
-    extern int             currentButtonIndex;
-    extern SimpleButton    buttonList[MAX_BUTTONS];
-    struct ButtonHandle    { int index = -1; uint32_t generation = 0; };
+    typedef WidgetHandle<SimpleButton> ButtonHandle;
 
     ButtonHandle addButton(int x, int y, int w, int h, const char *label, void (*callback)(const char *label), uint8_t fontCode = 4, uint16_t bgNormal = TFT_BLUE, uint16_t bgPressed = TFT_BLACK);
+    ButtonHandle addButton(int x, int y, int w, int h, const char *label, int id, UIEventCallback callback, void *context = nullptr, uint8_t fontCode = 4, uint16_t bgNormal = TFT_BLUE, uint16_t bgPressed = TFT_BLACK);
+    void setCallback(ButtonHandle handle, int id, UIEventCallback callback, void *context = nullptr);
     void updateButton(ButtonHandle handle, const char* newLabel, uint16_t bgNormal, uint16_t bgPressed);
     void updateButton(ButtonHandle handle, const char* newLabel, uint16_t bgNormal);
     void updateButton(ButtonHandle handle, const char* newLabel);
-    void drawButton(const SimpleButton &btn);
+    void drawButton(ButtonHandle handle);
     void drawAllButtons();
     void clearButton(ButtonHandle handle);
     void removeButton(ButtonHandle handle);
@@ -135,19 +413,18 @@ enum Quarter {
 
 #ifdef MICRO_UI_USE_LABELS
     struct LabelSprite {
-        int x, y, w, h;
+#ifndef MICRO_UI_FRAMEBUFFER
         TFT_eSprite* sprite;
-        bool visible;
-        uint8_t fontCode;
+#endif
+        uint32_t generation = 0;
         uint16_t textColor;
         uint16_t bgColor;
+        uint8_t fontCode;
+        TextLayout layout;
         char lastText[MAX_LABEL_TEXT];
-        uint32_t generation = 0;
-        bool inUse = false;
     };
 
-    extern LabelSprite     labelList [MAX_LABELS];
-    struct LabelHandle     { int index = -1; uint32_t generation = 0; };
+    typedef WidgetHandle<LabelSprite> LabelHandle;
 
     LabelHandle addLabel(int x, int y, const char* text, uint8_t fontCode = 4, uint16_t textColor = TFT_WHITE, uint16_t bgColor = TFT_BLACK);
     void updateLabel(LabelHandle handle, const char* text, uint16_t textColor, uint16_t bgColor);
@@ -160,43 +437,430 @@ enum Quarter {
 
 #ifdef MICRO_UI_USE_SLIDERS
     struct SliderSprite {
-        int x, y, w, h;                 // Container coordinates and dimensions
+#ifndef MICRO_UI_FRAMEBUFFER
         TFT_eSprite *sprite;           // Off-screen sprite for smooth drawing
+#endif
         void (*callback)(int value);   // Callback receives slider value (0–100)
+        UIEventCallback onEvent;       // Gets EVENT_VALUE; see setCallback()
+        void *context;
+        int16_t id;
 
         uint16_t trackColor;
         uint16_t buttonColorNormal;
         uint16_t buttonColorPressed;
-        bool visible;
-        bool pressed;
-        int value;                     // 0–100
+        int16_t value;                 // 0–100
+#ifdef MICRO_UI_USE_SETTINGS
+        SettingHandle setting;         // Optional setting kept in sync while dragging
+#endif
         uint32_t generation = 0;
-        bool inUse = false;
     };
 
-    extern int             currentSliderIndex;
-    extern SliderSprite    sliderList[MAX_SLIDERS];
-    struct SliderHandle    { int index = -1; uint32_t generation = 0; };
+    typedef WidgetHandle<SliderSprite> SliderHandle;
 
     SliderHandle addSlider(int x, int y, int w, int h, int value, void (*callback)(int value), uint16_t trackColor, uint16_t buttonColorNormal, uint16_t buttonColorPressed);
-    void drawSlider(const SliderSprite &sldr);
+    SliderHandle addSlider(int x, int y, int w, int h, int value, int id, UIEventCallback callback, void *context, uint16_t trackColor, uint16_t buttonColorNormal, uint16_t buttonColorPressed);
+    void setCallback(SliderHandle handle, int id, UIEventCallback callback, void *context = nullptr);
+#ifdef MICRO_UI_USE_SETTINGS
+    void bindSliderSetting(SliderHandle handle, SettingHandle setting);
+#endif
+    void drawSlider(SliderHandle handle);
     void drawAllSliders();
     void clearSlider(SliderHandle handle);
     void removeSlider(SliderHandle handle);
     void removeAllSliders();
 #endif
 
+#ifdef MICRO_UI_USE_LISTS
+    // A virtualised list or table. Rows are never stored: rowText() is
+    // asked for the cells of the visible rows only, and each row is
+    // drawn through one row-sized sprite, so RAM does not grow with
+    // rowCount. Drag to scroll, tap to select.
+    //
+    // With the panel in its native portrait rotation, one full-width
+    // list per screen scrolls with the ILI9341 vertical scroll
+    // registers and only newly exposed rows are drawn. Anywhere else
+    // (including the default landscape rotation, where the panel's
+    // scroll axis is horizontal) a scroll redraws the visible rows.
+    struct ScrollList {
+        TFT_eSprite* sprite;           // One row tall, reused for every row
+        void (*rowText)(int row, int column, char* out, size_t len);
+        void (*callback)(int row);     // Row tapped, or nullptr
+        UIEventCallback onEvent;       // Gets EVENT_SELECT; see setCallback()
+        void *context;
+        int16_t id;
+        const uint8_t* columnWidths;   // Table mode, owned by the caller; nullptr: one column
+
+        uint16_t textColor;
+        uint16_t bgColor;
+        uint16_t selectColor;
+        uint8_t fontCode;
+        uint8_t columnCount;
+        uint8_t rowHeight;
+        bool hardwareScroll;           // Owns the panel's scroll registers
+        bool dragging;
+        int16_t pressY;                // Touch y when the finger went down
+        int rowCount;
+        int scrollY;                   // Content pixels above the top edge
+        int pressScrollY;
+        int selected;                  // -1: none
+        uint32_t generation = 0;
+    };
+
+    typedef WidgetHandle<ScrollList> ListHandle;
+
+    ListHandle addList(int x, int y, int w, int h, int rowCount, void (*rowText)(int row, int column, char* out, size_t len), void (*callback)(int row) = nullptr, uint8_t fontCode = 2, uint16_t textColor = TFT_WHITE, uint16_t bgColor = TFT_BLACK, uint16_t selectColor = TFT_BLUE);
+    void setCallback(ListHandle handle, int id, UIEventCallback callback, void *context = nullptr);
+    void setListColumns(ListHandle handle, const uint8_t* widths, uint8_t count);
+    void setListRowCount(ListHandle handle, int rowCount);
+    void updateListRow(ListHandle handle, int row);
+    void scrollList(ListHandle handle, int pixels);
+    void scrollListTo(ListHandle handle, int row);
+    int  getListSelection(ListHandle handle);
+    void drawList(ListHandle handle);
+    void drawAllLists();
+    void removeList(ListHandle handle);
+    void removeAllLists();
+#endif
+
+#ifdef MICRO_UI_USE_CHARTS
+    // A sweeping strip chart. Each column keeps the min/max row of every
+    // series over samplesPerColumn samples, so a fast signal is decimated
+    // without losing its peaks. The newest column is redrawn only when
+    // its span grows, then the write position sweeps right and wraps,
+    // clearing a short gap ahead of it: one column of pixels per sample
+    // at most, never the whole plot. Heights are limited to 255 px.
+    struct TrendChart {
+        TFT_eSprite* sprite;           // One column tall, reused for every column
+        uint8_t* spans;                // [column][series] min, max row; in the arena block
+        float minValue;
+        float maxValue;
+        uint16_t seriesColor[CHART_MAX_SERIES];
+        uint16_t bgColor;
+        uint16_t gridColor;
+        uint16_t samplesPerColumn;
+        uint16_t pending;              // Samples already folded into the head column
+        int16_t head;                  // Column being written
+        uint8_t seriesCount;
+        uint8_t lastRow[CHART_MAX_SERIES]; // Newest sample, joined to the next
+        bool hasLast;
+        uint32_t generation = 0;
+    };
+
+    typedef WidgetHandle<TrendChart> ChartHandle;
+
+    ChartHandle addChart(int x, int y, int w, int h, uint8_t seriesCount, float minValue, float maxValue, uint16_t samplesPerColumn = 1, uint16_t bgColor = TFT_BLACK, uint16_t gridColor = TFT_DARKGREY);
+    void setChartSeriesColor(ChartHandle handle, uint8_t series, uint16_t color);
+    void setChartRange(ChartHandle handle, float minValue, float maxValue);
+    void chartPush(ChartHandle handle, const float* values);   // One value per series
+    void chartPush(ChartHandle handle, float value);
+    void clearChart(ChartHandle handle);
+    void drawChart(ChartHandle handle);
+    void drawAllCharts();
+    void removeChart(ChartHandle handle);
+    void removeAllCharts();
+#endif
+
+#ifdef MICRO_UI_USE_PROGRESS
+    // Retained progress bar, 0–100. setProgress() paints only the strip
+    // between the old and new fill edge.
+    struct ProgressBar {
+        uint16_t fillColor;
+        uint16_t bgColor;
+        uint16_t borderColor;
+        int16_t value;
+        uint32_t generation = 0;
+    };
+
+    typedef WidgetHandle<ProgressBar> ProgressHandle;
+
+    ProgressHandle addProgressBar(int x, int y, int w, int h, int value = 0, uint16_t fillColor = TFT_GREEN, uint16_t bgColor = TFT_DARKGREY, uint16_t borderColor = TFT_WHITE);
+    void setProgress(ProgressHandle handle, int value);
+    void drawProgress(ProgressHandle handle);
+    void drawAllProgressBars();
+    void removeProgressBar(ProgressHandle handle);
+    void removeAllProgressBars();
+#endif
+
+#ifdef MICRO_UI_USE_GAUGES
+    // Retained arc gauge, 0–100 swept clockwise from startAngle to
+    // endAngle (degrees, 0 at 12 o'clock). setGauge() repaints only the
+    // ring sector between the old and new value, using fillArc() spans.
+    struct ArcGauge {
+        uint16_t fillColor;
+        uint16_t trackColor;
+        int16_t startAngle;
+        int16_t endAngle;
+        uint8_t thickness;
+        int16_t value;
+        uint32_t generation = 0;
+    };
+
+    typedef WidgetHandle<ArcGauge> GaugeHandle;
+
+    GaugeHandle addGauge(int cx, int cy, int radius, int thickness, int value = 0, uint16_t fillColor = TFT_GREEN, uint16_t trackColor = TFT_DARKGREY, int16_t startAngle = -135, int16_t endAngle = 135);
+    void setGauge(GaugeHandle handle, int value);
+    void drawGauge(GaugeHandle handle);
+    void drawAllGauges();
+    void removeGauge(GaugeHandle handle);
+    void removeAllGauges();
+#endif
+
+#ifdef MICRO_UI_USE_IMAGES
+    // Compressed images in flash, as written by tools/micro_ui_image.py.
+    // Pixels are run-length coded in raster order, with runs carrying
+    // on across rows: a control byte c < 0x80 is followed by c + 1
+    // literal pixels, c >= 0x80 by one pixel repeated (c & 0x7F) + 1
+    // times. IMAGE_RLE565 pixels are little-endian RGB565 words;
+    // IMAGE_RLE_INDEXED pixels are one byte indexing palette.
+    enum ImageFormat {
+        IMAGE_RLE565,
+        IMAGE_RLE_INDEXED
+    };
+
+    struct MicroImage {
+        uint16_t width;
+        uint16_t height;
+        uint8_t format;                // ImageFormat
+        uint16_t paletteSize;
+        const uint16_t *palette;       // IMAGE_RLE_INDEXED only
+        const uint8_t *data;
+        uint32_t dataSize;
+    };
+
+    // Keeps an image on screen by handle, so icons that change state can
+    // be swapped with setImage() and are redrawn with the screen.
+    struct ImageView {
+        const MicroImage *image;
+        uint32_t generation = 0;
+    };
+
+    typedef WidgetHandle<ImageView> ImageHandle;
+
+    ImageHandle addImage(int x, int y, const MicroImage *image);
+    void setImage(ImageHandle handle, const MicroImage *image);
+    void drawImage(ImageHandle handle);
+    void drawAllImages();
+    void removeImage(ImageHandle handle);
+    void removeAllImages();
+
+    // Decodes an image straight to the panel, clipped to the screen.
+    void drawImage(int x, int y, const MicroImage *image);
+#endif
+
+#ifdef MICRO_UI_USE_FONTS
+    // Subset anti-aliased fonts in flash, as written by
+    // tools/micro_ui_font.py. Each glyph is cropped to its ink and packed
+    // at bpp bits per pixel, MSB first, with 0 as background. Glyphs and
+    // kerning pairs are sorted by code point for binary search.
+    struct MicroFontGlyph {
+        uint16_t codepoint;
+        uint8_t width;
+        uint8_t height;
+        int8_t xOffset;                // Ink left edge from the pen position
+        int8_t yOffset;                // Ink top edge from the top of the line
+        uint8_t xAdvance;
+        uint32_t bitmap;               // Offset into MicroFont::bitmaps
+    };
+
+    struct MicroFontKern {
+        uint16_t left;
+        uint16_t right;
+        int8_t adjust;                 // Added to the pen after the left glyph
+    };
+
+    struct MicroFont {
+        const MicroFontGlyph *glyphs;
+        const uint8_t *bitmaps;
+        const MicroFontKern *kerns;
+        uint16_t glyphCount;
+        uint16_t kernCount;
+        uint8_t bpp;                   // 1, 2 or 4
+        uint8_t lineHeight;
+        uint8_t baseline;              // From the top of the line
+    };
+
+    // Text is UTF-8; characters missing from the subset are skipped.
+    // drawFontText() paints the whole line box from (x, y), blending the
+    // edges onto bgColor, so it can overwrite old text without a clear.
+    int  fontTextWidth(const MicroFont *font, const char *text);
+    void drawFontText(int x, int y, const char *text, const MicroFont *font, uint16_t textColor = TFT_WHITE, uint16_t bgColor = BACKGROUND_COLOR);
+#endif
+
+// ===== Displays =====
+// A display is one panel and the widget tree on it. It owns the arena
+// and widget lists of its current screen, its touch capture and event
+// queue, its size and rotation and, with MICRO_UI_FRAMEBUFFER, its
+// frame and dirty lines. Every function in this header works on the
+// current display, chosen with useDisplay(); handles only mean
+// something while their display is current. microUIInit() starts
+// `primaryDisplay` on tft and touchscreen and selects it, so a sketch
+// with one panel never names a display.
+//
+// Font advances, button face sprites, settings, the profiler and the
+// latency histogram are shared by all displays. A second panel, here a
+// read-out without touch, is begun by the sketch, which knows its pins:
+//
+//   TFT_eSPI     remotePanel;
+//   MicroDisplay remote(remotePanel, 160, 128, 1);
+//
+//   remotePanel.begin();
+//   microUIAddDisplay(remote);     // After microUIInit()
+//   useDisplay(remote);
+//   addLabel(5, 5, "0.00 kg");
+//   useDisplay(primaryDisplay);
+//
+// microUILoopHandler() serves the displays in the order they were
+// added: touch, events, then flush, with each one current while its
+// callbacks run. It leaves the sketch's choice current on return.
+#define MAX_DISPLAYS        2     // The primary display included
+
+// The widget under the finger, if any. `type` is its registry position.
+struct TouchCapture {
+    int8_t      type;
+    int         index;
+    uint32_t    generation;
+    int16_t     x, y;           // Latest touch position
+};
+
+struct MicroDisplay {
+    MicroDisplay(TFT_eSPI &panel, int16_t width, int16_t height, uint8_t rotation,
+                 XPT2046_Touchscreen *touch = nullptr);
+
+    TFT_eSPI*               panel;
+    XPT2046_Touchscreen*    touch;          // nullptr for a panel without touch
+    TFT_eSPI*               canvas;         // Where widgets draw: the panel or the frame
+    int16_t                 width;
+    int16_t                 height;
+    uint8_t                 rotation;
+
+    // Widgets of the current screen; see "Widget Arena" in micro_ui.cpp
+    uint8_t                 arena[MICRO_UI_ARENA_SIZE] __attribute__((aligned(8)));
+    size_t                  arenaTop        = 0;
+    size_t                  arenaHigh       = 0;
+#ifdef MICRO_UI_USE_BUTTONS
+    WidgetStore<SimpleButton, MAX_BUTTONS>      buttons;
+#endif
+#ifdef MICRO_UI_USE_LABELS
+    WidgetStore<LabelSprite, MAX_LABELS>        labels;
+#endif
+#ifdef MICRO_UI_USE_SLIDERS
+    WidgetStore<SliderSprite, MAX_SLIDERS>      sliders;
+#endif
+#ifdef MICRO_UI_USE_LISTS
+    WidgetStore<ScrollList, MAX_LISTS>          lists;
+#endif
+#ifdef MICRO_UI_USE_CHARTS
+    WidgetStore<TrendChart, MAX_CHARTS>         charts;
+#endif
+#ifdef MICRO_UI_USE_PROGRESS
+    WidgetStore<ProgressBar, MAX_PROGRESS_BARS> progressBars;
+#endif
+#ifdef MICRO_UI_USE_GAUGES
+    WidgetStore<ArcGauge, MAX_GAUGES>           gauges;
+#endif
+#ifdef MICRO_UI_USE_IMAGES
+    WidgetStore<ImageView, MAX_IMAGES>          images;
+#endif
+
+    TouchCapture            touchCapture    = { -1, -1, 0, 0, 0 };
+    unsigned long           touchStartTime  = 0;
+
+    UIEvent                 eventQueue[EVENT_QUEUE_SIZE];
+    uint8_t                 eventHead       = 0;
+    uint8_t                 eventCount      = 0;
+    uint32_t                eventsDropped   = 0;
+    UIEventCallback         eventHandler    = nullptr;
+    void*                   eventContext    = nullptr;
+
+#ifdef MICRO_UI_FRAMEBUFFER
+    TFT_eSprite*            frame           = nullptr;  // Until microUIInit() or microUIAddDisplay()
+    int16_t*                dirtyX0         = nullptr;  // Dirty span of each line, [x0, x1)
+    int16_t*                dirtyX1         = nullptr;
+    int16_t                 dirtyTop        = 0;        // Lines outside [top, bottom) are clean
+    int16_t                 dirtyBottom     = 0;
+#endif
+};
+
+extern MicroDisplay primaryDisplay;
+
+bool          microUIAddDisplay(MicroDisplay &display);     // False once MAX_DISPLAYS are in use
+void          useDisplay(MicroDisplay &display);
+MicroDisplay& currentDisplay();
+
+// Turns the current display and its touch controller, swapping width
+// and height when the orientation changes, and clears the panel (and
+// frame). Clear the screen before and build the new one after.
+void          setDisplayRotation(uint8_t rotation);
+
 // ===== Dirty drawing functions =====
 void drawText(int x, int y, const char* txt, uint8_t fontCode = 4, uint16_t textColor = TFT_WHITE);
 void drawCenteredText(const char *message, uint8_t fontCode = 4, uint16_t textColor = TFT_WHITE, uint16_t bgColor = BACKGROUND_COLOR);
 void drawTriangleWithBorder(int x, int y, int w, int h, int borderWidth = 1, uint16_t fillColor = TFT_BLACK, int16_t borderColor = TFT_WHITE);
 void drawCircleWithBorder(int x, int y, int radius, int borderWidth = 1, uint16_t fillColor = TFT_BLUE, uint16_t borderColor = TFT_WHITE);
 void drawQuarterCircleWithBorder(int x, int y, int radius, int borderWidth = 1, uint16_t fillColor = TFT_BLUE, uint16_t borderColor = TFT_WHITE, Quarter quarter = BOTTOM_RIGHT);
+void fillArc(int cx, int cy, int radius, int thickness, float startAngle, float endAngle, uint16_t color);
+void drawProgressBar(int x, int y, int w, int h, int value, uint16_t fillColor = TFT_GREEN, uint16_t bgColor = TFT_DARKGREY);
+void FullWidthProgressBar(int value);
+
+// ===== Screen transitions =====
+// showScreen() brings in a new screen a strip per frame instead of
+// clearing the panel and redrawing it piece by piece. `build` is an
+// ordinary screen function starting with clearScreen(); it runs once
+// per strip with drawing clipped to the strip, so it should only add
+// widgets and draw. With MICRO_UI_FRAMEBUFFER it runs just once, on
+// the frame, and the strips are copied from there. Slides move the old
+// screen with the panel's scroll registers and need rotation 1; in
+// other rotations they wipe in the same direction. The call returns
+// once the new screen is complete, about `durationMs` later, and leaves
+// the figures in transitionStats.
+#define TRANSITION_MS           200     // Default duration
+#define TRANSITION_FRAME_US     16667   // Frame budget; strips are paced to one per frame
+
+enum UITransition : uint8_t {
+    TRANSITION_NONE,                    // Built in one go
+    TRANSITION_WIPE_LEFT,               // Revealed from the right edge
+    TRANSITION_WIPE_RIGHT,              // Revealed from the left edge
+    TRANSITION_WIPE_DOWN,               // Revealed from the top
+    TRANSITION_SLIDE_LEFT,              // Old screen pushed out to the left
+    TRANSITION_SLIDE_RIGHT              // Old screen pushed out to the right
+};
+
+struct TransitionStats {
+    uint16_t frames;
+    uint16_t framesOverBudget;
+    uint32_t slowestFrameMicros;
+    uint32_t totalMicros;               // From the call until the last strip is out
+};
+
+extern TransitionStats transitionStats;
+
+void showScreen(void (*build)(), UITransition transition, uint16_t durationMs = TRANSITION_MS);
+
+// ===== Framebuffer =====
+// With MICRO_UI_FRAMEBUFFER, widgets and drawing functions write into
+// the frame and mark the lines they touch. microUIFlush() sends the
+// marked part of each line range to the panel, one address window per
+// block of consecutive lines; microUILoopHandler() calls it at the end
+// of every pass, so only code drawing outside the loop needs to. In
+// sprite mode it does nothing.
+//
+// microUIFrame() is the frame itself, for effects that read pixels
+// back. Drawing on it marks lines like any widget; pushImage() and
+// other calls that write the buffer directly do not, so mark those
+// areas with microUIInvalidate().
+void microUIFlush();
+#ifdef MICRO_UI_FRAMEBUFFER
+TFT_eSprite& microUIFrame();
+void microUIInvalidate(int x, int y, int w, int h);
+#endif
 
 // Gneral functions
 void microUIInit();
 void microUILoopHandler();
 bool getTouch(int &x, int &y);
 void clearScreen();
+void drawAllWidgets();
+size_t microUIArenaUsed();
+size_t microUIArenaPeak();
 
 #endif
@@ -0,0 +1,468 @@
+#!/usr/bin/env python3
+"""Subset a TTF or BDF font into an anti-aliased MicroFont C header.
+
+Only the characters an app draws are kept. Each glyph is cropped to its
+ink and packed at 1, 2 or 4 bits per pixel; kerning pairs between kept
+glyphs come along from the TTF 'kern' table. The output header holds
+one `static const MicroFont`, drawn with drawFontText() in micro_ui.
+
+    python micro_ui_font.py Lato-Regular.ttf --size 28 --chars "0123456789.-kg " -o src/font_weight.h
+    python micro_ui_font.py big.bdf --oversample 2 --bpp 2 --name font_big -o src/font_big.h
+
+TrueType outlines are rasterised here with 16x16 supersampling, so only
+the standard library is needed; hinting, CFF outlines and GPOS kerning
+are not supported. BDF fonts are 1-bit: --oversample N shrinks an N
+times larger BDF and turns the coverage into grey levels.
+"""
+
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+
+SUPERSAMPLE = 16
+
+
+# ===== TrueType =====
+class TrueType:
+    def __init__(self, data):
+        self.data = data
+        count = struct.unpack(">H", data[4:6])[0]
+        self.tables = {}
+        for i in range(count):
+            tag, _, offset, length = struct.unpack(">4sIII", data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        if "glyf" not in self.tables:
+            raise ValueError("only TrueType (glyf) outlines are supported")
+
+        head = self.table("head")
+        self.units_per_em = struct.unpack(">H", head[18:20])[0]
+        self.loca_long = struct.unpack(">h", head[50:52])[0] == 1
+        hhea = self.table("hhea")
+        self.ascender, self.descender = struct.unpack(">hh", hhea[4:8])
+        self.num_hmetrics = struct.unpack(">H", hhea[34:36])[0]
+        self.num_glyphs = struct.unpack(">H", self.table("maxp")[4:6])[0]
+        self.cmap = self.read_cmap()
+        self.kerning = self.read_kern()
+
+    def table(self, tag):
+        offset, length = self.tables[tag]
+        return self.data[offset:offset + length]
+
+    def read_cmap(self):
+        cmap = self.table("cmap")
+        count = struct.unpack(">H", cmap[2:4])[0]
+        best = None
+        for i in range(count):
+            platform, encoding, offset = struct.unpack(">HHI", cmap[4 + 8 * i:12 + 8 * i])
+            fmt = struct.unpack(">H", cmap[offset:offset + 2])[0]
+            if (platform, encoding) in ((3, 10), (0, 4)) and fmt == 12:
+                best = (fmt, offset)
+            elif (platform == 3 and encoding == 1 or platform == 0) and fmt == 4 and best is None:
+                best = (fmt, offset)
+        if best is None:
+            raise ValueError("no Unicode cmap")
+        fmt, offset = best
+        mapping = {}
+        if fmt == 4:
+            segs = struct.unpack(">H", cmap[offset + 6:offset + 8])[0] // 2
+            base = offset + 14
+            ends = struct.unpack(">%dH" % segs, cmap[base:base + 2 * segs])
+            starts = struct.unpack(">%dH" % segs, cmap[base + 2 * segs + 2:base + 4 * segs + 2])
+            deltas = struct.unpack(">%dh" % segs, cmap[base + 4 * segs + 2:base + 6 * segs + 2])
+            range_base = base + 6 * segs + 2
+            ranges = struct.unpack(">%dH" % segs, cmap[range_base:range_base + 2 * segs])
+            for s in range(segs):
+                for code in range(starts[s], ends[s] + 1):
+                    if code == 0xFFFF:
+                        continue
+                    if ranges[s] == 0:
+                        glyph = (code + deltas[s]) & 0xFFFF
+                    else:
+                        at = range_base + 2 * s + ranges[s] + 2 * (code - starts[s])
+                        glyph = struct.unpack(">H", cmap[at:at + 2])[0]
+                        if glyph:
+                            glyph = (glyph + deltas[s]) & 0xFFFF
+                    if glyph:
+                        mapping[code] = glyph
+        else:
+            groups = struct.unpack(">I", cmap[offset + 12:offset + 16])[0]
+            for g in range(groups):
+                start, end, glyph = struct.unpack(">III", cmap[offset + 16 + 12 * g:offset + 28 + 12 * g])
+                for code in range(start, end + 1):
+                    mapping[code] = glyph + code - start
+        return mapping
+
+    def read_kern(self):
+        pairs = {}
+        if "kern" not in self.tables:
+            return pairs
+        kern = self.table("kern")
+        count = struct.unpack(">H", kern[2:4])[0]
+        pos = 4
+        for _ in range(count):
+            length, coverage = struct.unpack(">HH", kern[pos + 2:pos + 6])
+            if coverage >> 8 == 0 and coverage & 1:   # Format 0, horizontal
+                n = struct.unpack(">H", kern[pos + 6:pos + 8])[0]
+                for i in range(n):
+                    left, right, value = struct.unpack(">HHh", kern[pos + 14 + 6 * i:pos + 20 + 6 * i])
+                    pairs[(left, right)] = value
+            pos += length
+        return pairs
+
+    def advance(self, glyph):
+        hmtx = self.table("hmtx")
+        index = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack(">H", hmtx[4 * index:4 * index + 2])[0]
+
+    def glyph_data(self, glyph):
+        loca = self.table("loca")
+        if self.loca_long:
+            start, end = struct.unpack(">II", loca[4 * glyph:4 * glyph + 8])
+        else:
+            start, end = (2 * v for v in struct.unpack(">HH", loca[2 * glyph:2 * glyph + 4]))
+        offset = self.tables["glyf"][0]
+        return self.data[offset + start:offset + end]
+
+    def contours(self, glyph, depth=0):
+        """Outline as lists of (x, y, on_curve) points in font units."""
+        data = self.glyph_data(glyph)
+        if not data:
+            return []
+        ncont = struct.unpack(">h", data[0:2])[0]
+        if ncont < 0:
+            return self.composite(data, depth)
+
+        ends = struct.unpack(">%dH" % ncont, data[10:10 + 2 * ncont])
+        npts = ends[-1] + 1 if ncont else 0
+        pos = 10 + 2 * ncont
+        pos += 2 + struct.unpack(">H", data[pos:pos + 2])[0]   # Skip instructions
+        flags = []
+        while len(flags) < npts:
+            flag = data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 8:
+                flags.extend([flag] * data[pos])
+                pos += 1
+        coords = []
+        for short, same in ((2, 16), (4, 32)):
+            value, axis = 0, []
+            for flag in flags[:npts]:
+                if flag & short:
+                    delta = data[pos]
+                    pos += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack(">h", data[pos:pos + 2])[0]
+                    pos += 2
+                axis.append(value)
+            coords.append(axis)
+        points = [(x, y, f & 1) for x, y, f in zip(coords[0], coords[1], flags)]
+        out, start = [], 0
+        for end in ends:
+            out.append(points[start:end + 1])
+            start = end + 1
+        return out
+
+    def composite(self, data, depth):
+        out, pos, more = [], 10, True
+        while more and depth < 8:
+            flags, glyph = struct.unpack(">HH", data[pos:pos + 4])
+            pos += 4
+            if flags & 1:
+                dx, dy = struct.unpack(">hh", data[pos:pos + 4])
+                pos += 4
+            else:
+                dx, dy = struct.unpack(">bb", data[pos:pos + 2])
+                pos += 2
+            if not flags & 2:
+                dx = dy = 0     # Point matching is not supported
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack(">h", data[pos:pos + 2])[0] / 16384.0
+                pos += 2
+            elif flags & 0x40:
+                a, d = (v / 16384.0 for v in struct.unpack(">hh", data[pos:pos + 4]))
+                pos += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384.0 for v in struct.unpack(">hhhh", data[pos:pos + 8]))
+                pos += 8
+            for contour in self.contours(glyph, depth + 1):
+                out.append([(x * a + y * c + dx, x * b + y * d + dy, on) for x, y, on in contour])
+            more = flags & 0x20
+        return out
+
+
+def flatten_contour(points, scale):
+    """Quadratic contour to a closed polyline in pixels (y up)."""
+    if not points:
+        return []
+    pts = [(x * scale, y * scale, on) for x, y, on in points]
+    # Start on an on-curve point, inventing one between two off points
+    start = next((i for i, p in enumerate(pts) if p[2]), None)
+    if start is None:
+        a, b = pts[0], pts[1]
+        pts.insert(1, ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, 1))
+        start = 1
+    pts = pts[start:] + pts[:start]
+    line = [(pts[0][0], pts[0][1])]
+    control = None
+    for x, y, on in pts[1:] + pts[:1]:
+        if on:
+            if control is None:
+                line.append((x, y))
+            else:
+                line.extend(quad(line[-1], control, (x, y)))
+                control = None
+        elif control is None:
+            control = (x, y)
+        else:
+            mid = ((control[0] + x) / 2, (control[1] + y) / 2)
+            line.extend(quad(line[-1], control, mid))
+            control = (x, y)
+    return line
+
+
+def quad(p0, p1, p2):
+    steps = max(2, int(math.hypot(p2[0] - p0[0], p2[1] - p0[1]) * 2))
+    out = []
+    for i in range(1, steps + 1):
+        t = i / steps
+        u = 1 - t
+        out.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return out
+
+
+def rasterise(polylines, x0, y0, w, h):
+    """Non-zero coverage (0.0-1.0) of a w x h pixel box whose top-left is
+    at (x0, y0) in y-down pixels, sampled SUPERSAMPLE^2 times per pixel."""
+    edges = []
+    for line in polylines:
+        for (ax, ay), (bx, by) in zip(line, line[1:] + line[:1]):
+            if ay != by:
+                edges.append((ax, -ay, bx, -by))    # Flip to y-down
+    cover = [[0] * w for _ in range(h)]
+    n = SUPERSAMPLE
+    for sy in range(h * n):
+        y = y0 + (sy + 0.5) / n
+        hits = []
+        for ax, ay, bx, by in edges:
+            if (ay <= y) != (by <= y):
+                hits.append((ax + (y - ay) * (bx - ax) / (by - ay), 1 if by > ay else -1))
+        hits.sort()
+        winding, row = 0, cover[sy // n]
+        for i, (x, direction) in enumerate(hits[:-1]):
+            winding += direction
+            if not winding:
+                continue
+            # Sample columns whose centre lies in [x, next x)
+            first = max(0, int(math.ceil((x - x0) * n - 0.5)))
+            last = min(w * n, int(math.ceil((hits[i + 1][0] - x0) * n - 0.5)))
+            for sx in range(first, last):
+                row[sx // n] += 1
+    return [[c / (n * n) for c in row] for row in cover]
+
+
+def load_ttf(path, size, chars):
+    font = TrueType(open(path, "rb").read())
+    scale = size / font.units_per_em
+    ascent = int(math.ceil(font.ascender * scale))
+    descent = int(math.ceil(-font.descender * scale))
+    glyphs, ids = {}, {}
+    for code in chars:
+        gid = font.cmap.get(code)
+        if gid is None:
+            print("warning: U+%04X not in font, skipped" % code, file=sys.stderr)
+            continue
+        lines = [flatten_contour(c, scale) for c in font.contours(gid)]
+        advance = int(round(font.advance(gid) * scale))
+        pts = [p for line in lines for p in line]
+        if pts:
+            left = int(math.floor(min(p[0] for p in pts)))
+            right = int(math.ceil(max(p[0] for p in pts)))
+            top = int(math.floor(-max(p[1] for p in pts)))
+            bottom = int(math.ceil(-min(p[1] for p in pts)))
+            cover = rasterise(lines, left, top, right - left, bottom - top)
+        else:
+            left = top = 0
+            cover = []
+        glyphs[code] = (advance, left, top + ascent, cover)
+        ids[code] = gid
+    kerns = {}
+    for a in ids:
+        for b in ids:
+            value = font.kerning.get((ids[a], ids[b]))
+            if value:
+                kerns[(a, b)] = int(round(value * scale))
+    return ascent + descent, ascent, glyphs, kerns
+
+
+# ===== BDF =====
+def load_bdf(path, oversample, chars):
+    ascent = descent = 0
+    glyphs = {}
+    wanted = set(chars)
+    with open(path, "r", encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "STARTCHAR":
+            code, advance, bbx, rows = None, 0, (0, 0, 0, 0), []
+            for line in lines:
+                words = line.split()
+                if words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    advance = int(words[1])
+                elif words[0] == "BBX":
+                    bbx = tuple(int(v) for v in words[1:5])
+                elif words[0] == "BITMAP":
+                    for _ in range(bbx[1]):
+                        rows.append(int(next(lines), 16))
+                elif words[0] == "ENDCHAR":
+                    break
+            if code in wanted:
+                w, h, bx, by = bbx
+                bits = (w + 7) // 8 * 8
+                glyphs[code] = (advance, bx, ascent - by - h,
+                                [[(r >> (bits - 1 - x)) & 1 for x in range(w)] for r in rows])
+    if oversample > 1:
+        glyphs = {code: shrink(g, oversample) for code, g in glyphs.items()}
+    line_height = (ascent + descent + oversample - 1) // oversample
+    return line_height, ascent // oversample, glyphs, {}
+
+
+def shrink(glyph, n):
+    """Box-filter an oversampled 1-bit glyph down by n, keeping position."""
+    advance, left, top, bits = glyph
+    x0, y0 = left // n, top // n
+    w = (left + (len(bits[0]) if bits else 0) + n - 1) // n - x0
+    h = (top + len(bits) + n - 1) // n - y0
+    cover = [[0.0] * w for _ in range(h)]
+    for y, row in enumerate(bits):
+        for x, bit in enumerate(row):
+            if bit:
+                cover[(top + y) // n - y0][(left + x) // n - x0] += 1.0 / (n * n)
+    return int(round(advance / n)), x0, y0, cover
+
+
+# ===== Packing =====
+def quantise(cover, bpp):
+    levels = (1 << bpp) - 1
+    return [[min(levels, int(c * levels + 0.5)) for c in row] for row in cover]
+
+
+def crop(levels, left, top):
+    """Trim blank rows and columns so only ink is stored."""
+    rows = [i for i, r in enumerate(levels) if any(r)]
+    if not rows:
+        return 0, 0, 0, 0, []
+    cols = [x for x in range(len(levels[0])) if any(r[x] for r in levels)]
+    r0, r1, c0, c1 = rows[0], rows[-1] + 1, cols[0], cols[-1] + 1
+    return left + c0, top + r0, c1 - c0, r1 - r0, [r[c0:c1] for r in levels[r0:r1]]
+
+
+def pack(levels, bpp):
+    """Pixels in raster order, MSB first, padded to a whole byte."""
+    out, acc, nbits = bytearray(), 0, 0
+    for row in levels:
+        for v in row:
+            acc = (acc << bpp) | v
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc = nbits = 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return bytes(out)
+
+
+def parse_chars(args):
+    text = args.chars
+    if args.chars_file:
+        with open(args.chars_file, encoding="utf-8") as f:
+            text = (text or "") + f.read()
+    codes = set(ord(c) for c in (text or "") if c not in "\r\n\t")
+    for part in args.range or []:
+        a, _, b = part.partition("-")
+        codes.update(range(int(a, 0), int(b or a, 0) + 1))
+    if not codes:
+        codes = set(range(0x20, 0x7F))
+    return sorted(codes)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("font", help="TTF or BDF file")
+    parser.add_argument("-o", "--out", help="output header, stdout if omitted")
+    parser.add_argument("--name", help="C name, from the output or font file by default")
+    parser.add_argument("--size", type=float, default=24, help="TTF pixels per em (default 24)")
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4), default=4, help="bits per pixel (default 4)")
+    parser.add_argument("--oversample", type=int, default=1, help="BDF only: shrink by this factor for grey levels")
+    parser.add_argument("--chars", help="characters to keep")
+    parser.add_argument("--chars-file", help="keep every character used in this UTF-8 file")
+    parser.add_argument("--range", action="append", help="keep a code point range, e.g. 0x30-0x39")
+    args = parser.parse_args()
+
+    chars = parse_chars(args)
+    with open(args.font, "rb") as f:
+        magic = f.read(4)
+    if magic == b"STAR":
+        line_height, baseline, glyphs, kerns = load_bdf(args.font, args.oversample, chars)
+    else:
+        line_height, baseline, glyphs, kerns = load_ttf(args.font, args.size, chars)
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.out or args.font))[0])
+    bitmap, table = bytearray(), []
+    for code in sorted(glyphs):
+        advance, left, top, cover = glyphs[code]
+        x, y, w, h, levels = crop(quantise(cover, args.bpp), left, top)
+        if max(w, h, advance) > 255 or not -128 <= x < 128 or not -128 <= y < 128:
+            raise ValueError("U+%04X is too large for the MicroFont format" % code)
+        table.append((code, w, h, x, y, advance, len(bitmap)))
+        bitmap += pack(levels, args.bpp)
+    kerns = sorted((a, b, max(-128, min(127, v))) for (a, b), v in kerns.items() if v)
+
+    out = ["// Generated by tools/micro_ui_font.py, do not edit.\n",
+           "// %s, %d glyphs, %d kerning pairs, %d bpp: %d bytes of flash\n"
+           % (os.path.basename(args.font), len(table), len(kerns), args.bpp,
+              len(bitmap) + 12 * len(table) + 6 * len(kerns) + 20),
+           "#pragma once\n", "#include \"micro_ui.h\"\n\n"]
+    items = ["0x%02X" % b for b in bitmap] or ["0"]
+    out.append("static const uint8_t %s_bitmaps[%d] = {\n%s\n};\n" % (name, len(items), ",\n".join(
+        "    " + ", ".join(items[i:i + 16]) for i in range(0, len(items), 16))))
+    out.append("static const MicroFontGlyph %s_glyphs[%d] = {\n" % (name, len(table)))
+    for code, w, h, x, y, advance, offset in table:
+        shown = chr(code) if 0x20 < code < 0x7F and chr(code) not in "\\'" else " "
+        out.append("    { 0x%04X, %3d, %3d, %4d, %4d, %3d, %6d },  // %s\n" % (code, w, h, x, y, advance, offset, shown))
+    out.append("};\n")
+    kern_ref = "nullptr"
+    if kerns:
+        out.append("static const MicroFontKern %s_kerns[%d] = {\n%s\n};\n" % (name, len(kerns), ",\n".join(
+            "    { 0x%04X, 0x%04X, %d }" % k for k in kerns)))
+        kern_ref = name + "_kerns"
+    out.append("static const MicroFont %s = { %s_glyphs, %s_bitmaps, %s, %d, %d, %d, %d, %d };\n"
+               % (name, name, name, kern_ref, len(table), len(kerns), args.bpp, line_height, baseline))
+
+    print("%s: %d glyphs, %d kerning pairs, %d bytes of bitmaps" % (name, len(table), len(kerns), len(bitmap)),
+          file=sys.stderr)
+    text = "".join(out)
+    if args.out:
+        with open(args.out, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
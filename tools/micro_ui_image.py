@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Convert PNG or PPM images into compressed MicroImage C arrays.
+
+Each input becomes one `static const MicroImage` in the output header,
+named after the file. Pixels are reduced to RGB565 and run-length
+coded as described in micro_ui.h; images with up to 256 colours are
+stored as palette indices when that is smaller. Transparent pixels are
+flattened onto --bg, since images are streamed straight to the panel.
+
+    python micro_ui_image.py icons/*.png -o src/icons.h
+    python micro_ui_image.py logo.png --format rle565 --bg 000000 -o logo.h
+
+Only the standard library is used: PNG support covers non-interlaced
+8-bit grey, RGB, palette and alpha images.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+IMAGE_RLE565 = 0
+IMAGE_RLE_INDEXED = 1
+FORMATS = {"rle565": IMAGE_RLE565, "indexed": IMAGE_RLE_INDEXED}
+
+MAX_RUN = 128   # Both run kinds store count - 1 in 7 bits
+
+
+# ===== Readers =====
+def read_png(data):
+    """Return (width, height, rows of (r, g, b, a) tuples)."""
+    pos, chunks = 8, {}
+    idat = bytearray()
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IDAT":
+            idat += body
+        else:
+            chunks[kind] = body
+    width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunks[b"IHDR"])
+    if depth != 8 or interlace:
+        raise ValueError("only 8-bit non-interlaced PNGs are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+
+    palette = []
+    if ctype == 3:
+        plte = chunks[b"PLTE"]
+        alpha = chunks.get(b"tRNS", b"")
+        for i in range(len(plte) // 3):
+            palette.append(tuple(plte[i * 3:i * 3 + 3]) + (alpha[i] if i < len(alpha) else 255,))
+
+    raw = zlib.decompress(bytes(idat))
+    stride = width * channels
+    prev = bytearray(stride)
+    rows, pos = [], 0
+    for _ in range(height):
+        ftype, line = raw[pos], bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+        px = [tuple(line[i:i + channels]) for i in range(0, stride, channels)]
+        if ctype == 0:
+            px = [(g, g, g, 255) for (g,) in px]
+        elif ctype == 2:
+            px = [p + (255,) for p in px]
+        elif ctype == 3:
+            px = [palette[i] for (i,) in px]
+        elif ctype == 4:
+            px = [(g, g, g, a) for g, a in px]
+        rows.append(px)
+    return width, height, rows
+
+
+def read_ppm(data):
+    fields, pos = [], 2
+    while len(fields) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(int(data[pos:end]))
+        pos = end
+    width, height, maxval = fields
+    if maxval != 255:
+        raise ValueError("only 8-bit PPMs are supported")
+    pix = data[pos + 1:pos + 1 + width * height * 3]
+    rows = []
+    for y in range(height):
+        line = pix[y * width * 3:(y + 1) * width * 3]
+        rows.append([tuple(line[i:i + 3]) + (255,) for i in range(0, len(line), 3)])
+    return width, height, rows
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data.startswith(b"\x89PNG\r\n\x1a\n"):
+        return read_png(data)
+    if data.startswith(b"P6"):
+        return read_ppm(data)
+    raise ValueError("%s: not a PNG or binary PPM" % path)
+
+
+# ===== Encoding =====
+def to565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def flatten(rows, bg):
+    """Blend alpha onto bg and reduce to a flat list of RGB565 values."""
+    out = []
+    for row in rows:
+        for r, g, b, a in row:
+            r, g, b = ((c * a + k * (255 - a) + 127) // 255 for c, k in zip((r, g, b), bg))
+            out.append(to565(r, g, b))
+    return out
+
+
+def rle(values, emit, min_repeat):
+    """Run-length code values. A control byte c < 0x80 is followed by
+    c + 1 literal values, c >= 0x80 by one value repeated (c & 0x7F) + 1
+    times. Runs ignore row boundaries."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for v in chunk:
+                out.extend(emit(v))
+
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < MAX_RUN and values[i + run] == values[i]:
+            run += 1
+        if run >= min_repeat:
+            flush()
+            out.append(0x80 | (run - 1))
+            out += emit(values[i])
+        else:
+            literal.extend(values[i:i + run])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def encode(pixels, fmt):
+    """Return (format, palette, data) for the requested or smallest format."""
+    candidates = []
+    if fmt in ("auto", "rle565"):
+        data = rle(pixels, lambda v: struct.pack("<H", v), 2)
+        candidates.append((len(data), IMAGE_RLE565, [], data))
+    if fmt in ("auto", "indexed"):
+        palette = sorted(set(pixels))
+        if len(palette) <= 256:
+            index = {c: i for i, c in enumerate(palette)}
+            data = rle([index[p] for p in pixels], lambda v: bytes((v,)), 3)
+            candidates.append((len(data) + 2 * len(palette), IMAGE_RLE_INDEXED, palette, data))
+        elif fmt == "indexed":
+            raise ValueError("%d colours after RGB565 reduction, indexed allows 256" % len(palette))
+    _, kind, palette, data = min(candidates, key=lambda c: c[0])
+    return kind, palette, data
+
+
+# ===== Output =====
+def c_name(path):
+    name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    return "_" + name if name[0].isdigit() else name
+
+
+def hex_lines(values, fmt, per_line):
+    items = [fmt % v for v in values]
+    return ",\n".join("    " + ", ".join(items[i:i + per_line]) for i in range(0, len(items), per_line))
+
+
+def emit_image(out, name, width, height, kind, palette, data):
+    out.append("static const uint8_t %s_data[%d] = {\n%s\n};\n" % (name, len(data), hex_lines(data, "0x%02X", 16)))
+    palette_ref = "nullptr"
+    if palette:
+        out.append("static const uint16_t %s_palette[%d] = {\n%s\n};\n" % (name, len(palette), hex_lines(palette, "0x%04X", 10)))
+        palette_ref = name + "_palette"
+    kind_name = "IMAGE_RLE565" if kind == IMAGE_RLE565 else "IMAGE_RLE_INDEXED"
+    out.append("static const MicroImage %s = { %d, %d, %s, %d, %s, %s_data, sizeof(%s_data) };\n"
+               % (name, width, height, kind_name, len(palette), palette_ref, name, name))
+
+
+def parse_colour(text):
+    value = int(text.lstrip("#"), 16)
+    return (value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("inputs", nargs="+", help="PNG or binary PPM files")
+    parser.add_argument("-o", "--out", help="output header, stdout if omitted")
+    parser.add_argument("--format", choices=["auto"] + list(FORMATS), default="auto",
+                        help="pixel coding; auto picks the smaller (default)")
+    parser.add_argument("--bg", type=parse_colour, default=(0, 0, 0),
+                        help="RRGGBB colour transparent pixels are flattened onto (default 000000)")
+    args = parser.parse_args()
+
+    out = ["// Generated by tools/micro_ui_image.py, do not edit.\n",
+           "#pragma once\n", "#include \"micro_ui.h\"\n"]
+    for path in args.inputs:
+        width, height, rows = load(path)
+        if width > 0xFFFF or height > 0xFFFF:
+            raise ValueError("%s: too large" % path)
+        kind, palette, data = encode(flatten(rows, args.bg), args.format)
+        name = c_name(path)
+        out.append("\n// %s: %dx%d, %d bytes of flash (%d raw)\n"
+                   % (os.path.basename(path), width, height, len(data) + 2 * len(palette), width * height * 2))
+        emit_image(out, name, width, height, kind, palette, data)
+        print("%s: %dx%d %s, %d -> %d bytes" % (name, width, height,
+              "indexed/%d" % len(palette) if palette else "rle565",
+              width * height * 2, len(data) + 2 * len(palette)), file=sys.stderr)
+
+    text = "".join(out)
+    if args.out:
+        with open(args.out, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()